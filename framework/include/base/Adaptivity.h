@@ -240,6 +240,21 @@ public:
    */
   bool isAdaptivityDue();
 
+  /**
+   * Records the wall time (in seconds) spent in the last adaptivity step and how much (in bytes)
+   * the peak resident memory of this process grew during it
+   */
+  void recordStepStatistics(Real wall_time, Real peak_memory_growth);
+
+  /// The wall time (in seconds) spent in the last adaptivity step on this process
+  Real stepWallTime() const { return _step_wall_time; }
+
+  /// The growth (in bytes) of the peak resident memory of this process in the last adaptivity step
+  Real stepPeakMemoryGrowth() const { return _step_peak_memory_growth; }
+
+  /// The peak resident memory (in bytes) of this process so far
+  static Real processPeakMemory();
+
 protected:
   FEProblemBase & _subproblem;
   MooseMesh & _mesh;
@@ -298,6 +313,12 @@ protected:
 
   /// Stores pointers to ErrorVectors associated with indicator field names
   std::map<std::string, std::unique_ptr<ErrorVector>> _indicator_field_to_error_vector;
+
+  /// The wall time spent in the last adaptivity step
+  Real _step_wall_time;
+
+  /// The growth of the peak resident memory of this process in the last adaptivity step
+  Real _step_peak_memory_growth;
 };
 
 template <typename T>
@@ -15,10 +15,15 @@
 
 #include "libmesh/dense_matrix.h"
 #include "libmesh/dense_vector.h"
+#include "libmesh/enum_elem_type.h"
 #include "libmesh/enum_quadrature_type.h"
 #include "libmesh/fe_type.h"
 #include "libmesh/tensor_tools.h"
 
+// C++ includes
+#include <set>
+#include <tuple>
+
 // libMesh forward declarations
 namespace libMesh
 {
@@ -114,6 +119,8 @@ public:
   FEBase *& getFE(FEType type, unsigned int dim)
   {
     buildFE(type);
+    // The FE object itself is used, so it has to be reinitialized on every element
+    _fe_used_directly.insert(type);
     return _fe[dim][type];
   }
 
@@ -912,7 +919,38 @@ public:
    */
   void setXFEM(std::shared_ptr<XFEMInterface> xfem) { _xfem = xfem; }
 
+  /**
+   * Whether reinit() computes the volume shape functions on elements with an affine map from
+   * cached reference values and a single Jacobian per element instead of reinitializing the
+   * libMesh FE objects
+   */
+  void setCacheShapeFunctions(bool cache) { _cache_shape_functions = cache; }
+
+  /**
+   * Whether the cached residual and Jacobian values are sorted and coalesced (the values for the
+   * same entry summed) as they accumulate so that they can be held until the end of a threaded
+   * loop and then added with a single call per vector and per matrix row
+   */
+  void setBatchCachedInsertion(bool batch) { _batch_cached_insertion = batch; }
+  bool batchCachedInsertion() const { return _batch_cached_insertion; }
+
+  /// Wall time (in seconds) spent adding cached values to residual vectors
+  Real cachedResidualInsertionTime() const { return _cached_residual_insertion_time; }
+
+  /// Wall time (in seconds) spent adding cached values to Jacobian matrices
+  Real cachedJacobianInsertionTime() const { return _cached_jacobian_insertion_time; }
+
 protected:
+  /**
+   * Sorts the cached residual values of a type by row and sums the values for the same row
+   */
+  void coalesceCachedResidual(unsigned int type);
+
+  /**
+   * Sorts the cached Jacobian values by row and column and sums the values for the same entry
+   */
+  void coalesceCachedJacobian();
+
   /**
    * Just an internal helper function to reinit the volume FE objects.
    *
@@ -920,6 +958,30 @@ protected:
    */
   void reinitFE(const Elem * elem);
 
+  /**
+   * Computes the constant Jacobian of elem into _affine_origin, _affine_jacobian, ... if elem has
+   * an affine map of a supported type
+   *
+   * @return Whether the cached shape functions can be used on elem
+   */
+  bool computeAffineMap(const Elem * elem);
+
+  /// Whether the shape functions of fe_type can be cached
+  bool canCacheShapes(const FEType & fe_type) const;
+
+  /**
+   * Returns the cached shapes of fe_type on elem (with the physical gradients computed from the
+   * current affine map) or NULL if they are not cached yet or can't be
+   */
+  struct CachedShapes;
+  CachedShapes * cachedShapes(const FEType & fe_type, const Elem * elem);
+
+  /**
+   * Saves the reference shape functions of fe, which was just reinitialized on elem, for later
+   * elements of the same type
+   */
+  void cacheShapes(const FEBase & fe, const FEType & fe_type, const Elem * elem);
+
   /**
    * Just an internal helper function to reinit the face FE objects.
    *
@@ -1010,6 +1072,43 @@ protected:
   /// The XFEM controller
   std::shared_ptr<XFEMInterface> _xfem;
 
+  /// Whether the shape functions on affine elements are computed from cached reference values
+  bool _cache_shape_functions;
+
+  /// The FE types whose FE objects are accessed through getFE()
+  std::set<FEType> _fe_used_directly;
+
+  /**
+   * Reference shape functions of one FE type on one element type at the points of one quadrature
+   * rule, these don't depend on the element for the families that can be cached
+   */
+  struct CachedShapes
+  {
+    /// The reference points the shape functions were computed at
+    std::vector<Point> _qrule_points;
+    std::vector<std::vector<Real>> _phi;
+    /// Derivatives along each of the reference directions
+    std::vector<std::vector<std::vector<Real>>> _dphidxi;
+    /// Physical gradients on the current element
+    std::vector<std::vector<RealGradient>> _grad_phi;
+  };
+
+  /// Cached shapes indexed by FE type, element type and quadrature rule
+  std::map<std::tuple<FEType, ElemType, const QBase *>, CachedShapes> _cached_shapes;
+
+  /// The affine map of the current element: x = _affine_origin + sum_k _affine_jacobian[k] *
+  /// (xi_k - _affine_origin_ref(k))
+  Point _affine_origin;
+  Point _affine_origin_ref;
+  RealGradient _affine_jacobian[LIBMESH_DIM];
+  /// Gradients of the reference coordinates and the Jacobian determinant of the affine map
+  RealGradient _affine_dxi[LIBMESH_DIM];
+  Real _affine_det;
+
+  /// Quadrature points and weights computed from the affine map
+  std::vector<Point> _affine_q_points;
+  std::vector<Real> _affine_JxW;
+
   /// The "volume" fe object that matches the current elem
   std::map<FEType, FEBase *> _current_fe;
   /// The "face" fe object that matches the current elem
@@ -1253,6 +1352,29 @@ protected:
 
   unsigned int _max_cached_jacobians;
 
+  /// Whether the cached values are coalesced and held until the end of the threaded loop
+  bool _batch_cached_insertion;
+
+  /// Cache sizes above which the cached values are coalesced again
+  std::vector<std::size_t> _residual_coalesce_size;
+  std::size_t _jacobian_coalesce_size;
+
+  /// Smallest cache size that gets coalesced before the values are added
+  static const std::size_t _min_coalesce_size = 4096;
+
+  /// Work storage for coalescing the cached values
+  std::vector<std::size_t> _coalesce_order;
+  std::vector<dof_id_type> _coalesce_rows;
+  std::vector<dof_id_type> _coalesce_cols;
+  std::vector<Real> _coalesce_values;
+
+  /// One row of coalesced Jacobian values being added
+  DenseMatrix<Number> _cached_jacobian_row;
+
+  /// Time spent in addCachedResidual() and addCachedJacobian()
+  Real _cached_residual_insertion_time;
+  Real _cached_jacobian_insertion_time;
+
   /// Will be true if our preconditioning matrix is a block-diagonal matrix.  Which means that we can take some shortcuts.
   unsigned int _block_diagonal_matrix;
 
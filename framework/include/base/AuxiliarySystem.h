@@ -13,6 +13,7 @@
 // MOOSE includes
 #include "SystemBase.h"
 #include "ExecuteMooseObjectWarehouse.h"
+#include "SparseGhostedVector.h"
 
 #include "libmesh/explicit_system.h"
 #include "libmesh/transient_system.h"
@@ -99,6 +100,10 @@ public:
   virtual void serializeSolution();
   virtual NumericVector<Number> & serializedSolution() override;
 
+  virtual SparseGhostedVector & sparseGhostedSolution() override;
+
+  virtual void meshChanged() override;
+
   // This is an empty function since the Aux system doesn't have a matrix!
   virtual void augmentSparsity(SparsityPattern::Graph & /*sparsity*/,
                                std::vector<dof_id_type> & /*n_nz*/,
@@ -173,6 +178,8 @@ protected:
   const NumericVector<Number> * _current_solution;
   /// Serialized version of the solution vector
   NumericVector<Number> & _serialized_solution;
+  /// Sparsely ghosted copy of the solution vector, if requested
+  std::unique_ptr<SparseGhostedVector> _sparse_ghosted_solution;
   /// Solution vector of the previous nonlinear iterate
   NumericVector<Number> * _solution_previous_nl;
   /// Time integrator
@@ -71,6 +71,14 @@ public:
   {
     return _undisplaced_system.residualGhosted();
   }
+  virtual SparseGhostedVector & sparseGhostedSolution() override
+  {
+    return _undisplaced_system.sparseGhostedSolution();
+  }
+  virtual SparseGhostedVector & sparseGhostedResidual() override
+  {
+    return _undisplaced_system.sparseGhostedResidual();
+  }
 
   virtual void augmentSendList(std::vector<dof_id_type> & send_list) override
   {
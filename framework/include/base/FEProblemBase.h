@@ -14,6 +14,7 @@
 #include "SubProblem.h"
 #include "GeometricSearchData.h"
 #include "PostprocessorData.h"
+#include "ReductionBatch.h"
 #include "VectorPostprocessorData.h"
 #include "Adaptivity.h"
 #include "InitialConditionWarehouse.h"
@@ -1318,6 +1319,12 @@ public:
 
   ExecuteMooseObjectWarehouse<MultiApp> & getMultiAppWarehouse() { return _multi_apps; }
 
+  /**
+   * Collects the reductions that user objects defer while they are finalized so they can be
+   * performed together, see UserObject::deferredGatherSum
+   */
+  ReductionBatch & reductionBatch() { return _reduction_batch; }
+
 protected:
   ///@{
   /**
@@ -1400,6 +1407,9 @@ protected:
   // postprocessors
   PostprocessorData _pps_data;
 
+  /// The reductions deferred by user objects while they are finalized
+  ReductionBatch _reduction_batch;
+
   // VectorPostprocessors
   VectorPostprocessorData _vpps_data;
 
@@ -1620,16 +1630,21 @@ FEProblemBase::finalizeUserObjects(const MooseObjectWarehouse<T> & warehouse)
         objects[i]->threadJoin(*(other_objects[i]));
     }
 
-    // Finalize them and save off PP values
+    // Finalize them, then perform the reductions they deferred all together
+    _reduction_batch.begin();
     for (auto & object : objects)
-    {
       object->finalize();
+    _reduction_batch.flush();
 
+    // Save off PP values
+    for (auto & object : objects)
+    {
       auto pp = std::dynamic_pointer_cast<Postprocessor>(object);
 
       if (pp)
         _pps_data.storeValue(pp->PPName(), pp->getValue());
     }
+    _reduction_batch.end();
   }
 }
 
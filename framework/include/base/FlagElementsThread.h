@@ -21,8 +21,11 @@ class DisplacedProblem;
 class FlagElementsThread : public ThreadedElementLoop<ConstElemRange>
 {
 public:
+  /**
+   * Sets the refinement flags of the elements in the range from the values of the marker
+   * variable, which are taken from the ghosted auxiliary solution.
+   */
   FlagElementsThread(FEProblemBase & fe_problem,
-                     std::vector<Number> & serialized_solution,
                      unsigned int max_h_level,
                      const std::string & marker_name);
 
@@ -41,7 +44,7 @@ protected:
   Adaptivity & _adaptivity;
   MooseVariableFE & _field_var;
   unsigned int _field_var_number;
-  std::vector<Number> & _serialized_solution;
+  const NumericVector<Number> & _solution;
   unsigned int _max_h_level;
 };
 
@@ -14,6 +14,7 @@
 #include "KernelWarehouse.h"
 #include "ConstraintWarehouse.h"
 #include "MooseObjectWarehouse.h"
+#include "SparseGhostedVector.h"
 
 #include "libmesh/transient_system.h"
 #include "libmesh/nonlinear_implicit_system.h"
@@ -336,6 +337,11 @@ public:
   virtual NumericVector<Number> & residualCopy() override;
   virtual NumericVector<Number> & residualGhosted() override;
 
+  virtual SparseGhostedVector & sparseGhostedSolution() override;
+  virtual SparseGhostedVector & sparseGhostedResidual() override;
+
+  virtual void meshChanged() override;
+
   virtual NumericVector<Number> & RHS() = 0;
 
   virtual void augmentSparsity(SparsityPattern::Graph & sparsity,
@@ -590,6 +596,10 @@ protected:
   /// Copy of the residual vector
   NumericVector<Number> & _residual_copy;
 
+  /// Sparsely ghosted copies of the solution and the residual, if requested
+  std::unique_ptr<SparseGhostedVector> _sparse_ghosted_solution;
+  std::unique_ptr<SparseGhostedVector> _sparse_ghosted_residual;
+
   /// Time integrator
   std::shared_ptr<TimeIntegrator> _time_integrator;
   /// solution vector for u^dot
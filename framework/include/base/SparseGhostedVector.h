@@ -0,0 +1,110 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef SPARSEGHOSTEDVECTOR_H
+#define SPARSEGHOSTEDVECTOR_H
+
+// MOOSE includes
+#include "Moose.h"
+#include "MooseTypes.h"
+
+#include "libmesh/numeric_vector.h"
+#include "libmesh/parallel_object.h"
+
+// C++ includes
+#include <memory>
+#include <set>
+#include <vector>
+
+// Forward declarations
+namespace libMesh
+{
+class System;
+}
+
+/**
+ * A copy of a vector of a System that holds the local degrees of freedom along with only those
+ * remote degrees of freedom that were requested, as an alternative to serializing the whole
+ * vector on every processor.
+ *
+ * Objects declare the remote degrees of freedom, elements or nodes they are going to read, usually
+ * in their constructor. The ghosted vector and the pattern for filling it with point-to-point
+ * communication are built from these requests the next time the vector is updated and are reused
+ * until the requests or the mesh change.
+ *
+ * All the degrees of freedom of the System on requested elements and nodes are ghosted. These
+ * have to be available in the local mesh (e.g. through geometric ghosting) so that their degrees
+ * of freedom can be found; elements and nodes that are not available are skipped. Since the
+ * numbering of the degrees of freedom changes with the mesh, requests for individual degrees of
+ * freedom are dropped when the mesh changes and have to be made again, e.g. in meshChanged() of a
+ * UserObject.
+ */
+class SparseGhostedVector : public libMesh::ParallelObject
+{
+public:
+  SparseGhostedVector(System & sys);
+
+  ///@{
+  /**
+   * Requests the given degree of freedom, all degrees of freedom on the element with the given
+   * id, or all degrees of freedom on the node with the given id to be available in the vector
+   */
+  void addDof(dof_id_type dof);
+  void addElem(dof_id_type elem_id);
+  void addNode(dof_id_type node_id);
+  ///@}
+
+  /**
+   * Marks the communication pattern as outdated after the mesh changed; requests for individual
+   * degrees of freedom are dropped
+   */
+  void meshChanged();
+
+  /**
+   * Copies the local and the requested entries of source, a vector of the System. This has to be
+   * called on all processors.
+   */
+  void update(const NumericVector<Number> & source);
+
+  /**
+   * The ghosted vector. Only the local and the requested degrees of freedom may be accessed.
+   */
+  const NumericVector<Number> & vector() const;
+
+  /**
+   * The value of the given local or requested degree of freedom
+   */
+  Number operator()(dof_id_type dof) const { return vector()(dof); }
+
+  /// The number of remote degrees of freedom held by the vector
+  std::size_t numGhostedDofs() const { return _send_list.size(); }
+
+protected:
+  /// Builds the ghosted vector for the current requests
+  void buildPattern();
+
+  /// The System whose vectors are ghosted
+  System & _sys;
+
+  /// The requested degrees of freedom, elements and nodes
+  std::set<dof_id_type> _dofs;
+  std::set<dof_id_type> _elem_ids;
+  std::set<dof_id_type> _node_ids;
+
+  /// The remote degrees of freedom held by the vector
+  std::vector<numeric_index_type> _send_list;
+
+  /// The ghosted vector
+  std::unique_ptr<NumericVector<Number>> _vector;
+
+  /// Whether _vector and _send_list correspond to the current requests and mesh
+  bool _pattern_valid;
+};
+
+#endif // SPARSEGHOSTEDVECTOR_H
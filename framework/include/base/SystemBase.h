@@ -34,6 +34,7 @@ typedef MooseVariableField<VectorValue<Real>> VectorMooseVariable;
 class MooseMesh;
 class SubProblem;
 class SystemBase;
+class SparseGhostedVector;
 
 // libMesh forward declarations
 namespace libMesh
@@ -184,6 +185,25 @@ public:
     mooseError("This system does not support getting a ghosted copy of the residual");
   }
 
+  /**
+   * Returns a copy of the solution vector that holds the local degrees of freedom along with the
+   * remote ones requested through it. Unlike serializedSolution(), only the requested entries are
+   * communicated.
+   */
+  virtual SparseGhostedVector & sparseGhostedSolution()
+  {
+    mooseError("This system does not support getting a sparsely ghosted copy of the solution");
+  }
+  virtual SparseGhostedVector & sparseGhostedResidual()
+  {
+    mooseError("This system does not support getting a sparsely ghosted copy of the residual");
+  }
+
+  /**
+   * Called after the mesh changed, to rebuild the sparsely ghosted vectors
+   */
+  virtual void meshChanged() {}
+
   /**
    * Will modify the send_list to add all of the extra ghosted dofs for this system
    */
@@ -138,7 +138,9 @@ protected:
    * This is a highly inefficient way to add a point where this DiracKernel needs to be
    * evaluated.
    *
-   * This spawns a search for the element containing that point!
+   * This spawns a search for the element containing that point!  Points added with an id are
+   * cached, so that the search is only done the first time a point is added, or when the point
+   * (see the allow_moving_points parameter) or the mesh moved too far from its cached element.
    */
   const Elem * addPoint(Point p, unsigned id = libMesh::invalid_uint);
 
@@ -220,6 +222,9 @@ protected:
   /// drop duplicate points or consider them in residual and Jacobian
   const bool _drop_duplicate_points;
 
+  /// whether points added with an ID may move between calls to addPoints()
+  const bool _allow_moving_points;
+
 private:
   /// Data structure for caching user-defined IDs which can be mapped to
   /// specific std::pair<const Elem*, Point> and avoid the PointLocator Elem lookup.
@@ -242,6 +247,19 @@ private:
   /// A helper function for addPoint(Point, id) for when
   /// id != invalid_uint.
   const Elem * addPointWithValidId(Point p, unsigned id);
+
+  /// A helper function for addPointWithValidId() on a replicated mesh,
+  /// where every processor caches all the points and no communication
+  /// is needed unless a point has to be searched for.
+  const Elem * addReplicatedPointWithValidId(Point p, unsigned id);
+
+  /// Returns the active Elem containing p among cached_elem, its
+  /// active children, and the active elements sharing a node with it,
+  /// or NULL if p is not in any of them.
+  const Elem * findPointNear(const Elem * cached_elem, const Point & p) const;
+
+  /// Errors out if a cached point moved although this is not allowed.
+  void checkCachedPoint(const Point & cached_point, const Point & p, unsigned id) const;
 };
 
 #endif
@@ -83,6 +83,26 @@ public:
    */
   const Elem * findPoint(Point p, const MooseMesh & mesh);
 
+  /**
+   * Same as findPoint(), but returns the Elem containing p on all processors instead of only on
+   * the processor owning it.  This may only be used with a replicated mesh.
+   */
+  const Elem * findPointOnAllProcessors(Point p, const MooseMesh & mesh);
+
+  ///@{
+  /**
+   * Counters of the lookups in the Dirac point caches of the DiracKernels: points found in their
+   * cached element, points found near their cached element after they or the mesh moved, and
+   * searches with the PointLocator.  The first two are counted on the processor owning the
+   * element, the last one on processor zero since the searches are done on all processors.
+   */
+  void countCacheHit() { ++_num_cache_hits; }
+  void countCacheRelocation() { ++_num_cache_relocations; }
+  unsigned long numCacheHits() const { return _num_cache_hits; }
+  unsigned long numCacheRelocations() const { return _num_cache_relocations; }
+  unsigned long numPointLocatorSearches() const { return _num_point_locator_searches; }
+  ///@}
+
 protected:
   /**
    * Check if two points are equal with respect to a tolerance
@@ -103,6 +123,11 @@ protected:
 
   /// threshold distance squared below which two points are considered identical
   const Real _point_equal_distance_sq;
+
+  /// Counters reported by numCacheHits(), numCacheRelocations() and numPointLocatorSearches()
+  unsigned long _num_cache_hits;
+  unsigned long _num_cache_relocations;
+  unsigned long _num_point_locator_searches;
 };
 
 #endif // DIRACKERNELINFO_H
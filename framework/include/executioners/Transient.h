@@ -11,6 +11,7 @@
 #define TRANSIENT_H
 
 #include "Executioner.h"
+#include "AndersonAcceleration.h"
 
 // System includes
 #include <string>
@@ -319,6 +320,23 @@ protected:
 
   /// The DoFs associates with all of the relaxed variables
   std::set<dof_id_type> _relaxed_dofs;
+
+  /// The postprocessors that are going to be relaxed
+  std::vector<PostprocessorName> _relaxed_pps;
+
+  /// The values of the relaxed DoFs and postprocessors after the previous Picard iteration
+  std::vector<Real> _relaxed_var_previous;
+  std::vector<Real> _relaxed_pp_previous;
+
+  /// Whether Anderson acceleration is used instead of a constant relaxation
+  const bool _anderson;
+
+  /// Whether the relaxed variables and postprocessors are updated between Picard iterations
+  const bool _relax_picard;
+
+  /// Relaxation or Anderson acceleration of the relaxed variables and postprocessors
+  AndersonAcceleration _variable_acceleration;
+  AndersonAcceleration _postprocessor_acceleration;
 };
 
 #endif // TRANSIENTEXECUTIONER_H
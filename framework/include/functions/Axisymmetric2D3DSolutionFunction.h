@@ -46,6 +46,9 @@ public:
   virtual void initialSetup() override;
 
 protected:
+  /// Thread this copy of the function is used on
+  const THREAD_ID _tid;
+
   /// Pointer to SolutionUserObject containing the solution of interest
   const SolutionUserObject * _solution_object_ptr;
 
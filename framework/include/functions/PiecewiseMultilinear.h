@@ -11,6 +11,10 @@
 #define PIECEWISEMULTILINEAR_H
 
 #include "Function.h"
+#include "IntervalLocator.h"
+
+// C++ includes
+#include <array>
 
 // Forward declarations
 class GriddedData;
@@ -45,6 +49,12 @@ public:
   virtual Real value(Real t, const Point & pt) override;
 
 private:
+  /// The largest dimension of the grid: one for each of x, y, z and t
+  static const unsigned int MAX_DIM = 4;
+
+  /// A point on the grid
+  typedef std::array<Real, MAX_DIM> GridPoint;
+
   /// object to provide function evaluations at points on the grid
   std::unique_ptr<GriddedData> _gridded_data;
   /// dimension of the grid
@@ -62,28 +72,37 @@ private:
   /// the grid
   std::vector<std::vector<Real>> _grid;
 
+  /// the function values at the grid points, f[i,j,k,l] being _fcn[i + j*_step[1] + ...]
+  std::vector<Real> _fcn;
+
+  /// the stride in _fcn of each axis
+  std::array<unsigned int, MAX_DIM> _step;
+
+  /// finds the grid interval containing a point along each axis
+  std::array<IntervalLocator, MAX_DIM> _locators;
+
   /**
    * This does the core work.  Given a point, pt, defined
    * on the grid (not the MOOSE simulation reference frame),
    * interpolate the gridded data to this point
    */
-  Real sample(const std::vector<Real> & pt);
+  Real sample(const GridPoint & pt);
 
   /**
-   * Operates on monotonically increasing in_arr.
+   * Operates on monotonically increasing in_arr = _grid[axis].
    * Finds lower_x and upper_x which satisfy in_arr[lower_x] < x <= in_arr[upper_x].
    * End conditions: if x<in_arr[0] then lower_x = 0 = upper_x is returned
    *                 if x>in_arr[N-1] then lower_x = N-1 = upper_x is returned (N=size of in_arr)
    *
-   * @param in_arr The monotonically increasing vector of real numbers
+   * @param axis The axis of the grid whose monotonically increasing values are searched
    * @param x The real value for which we want the neighbor indices
    * @param lower_x Upon return will contain lower_x specified above
    * @param upper_x Upon return will contain upper_x specified above
    */
-  void getNeighborIndices(std::vector<Real> in_arr,
+  void getNeighborIndices(unsigned int axis,
                           Real x,
                           unsigned int & lower_x,
-                          unsigned int & upper_x);
+                          unsigned int & upper_x) const;
 };
 
 #endif // PIECEWISEMULTILINEAR_H
@@ -0,0 +1,107 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef FACEBOUNDINGVOLUMEHIERARCHY_H
+#define FACEBOUNDINGVOLUMEHIERARCHY_H
+
+// MOOSE includes
+#include "MooseTypes.h"
+
+#include "libmesh/bounding_box.h"
+
+// Forward declarations
+class MooseMesh;
+
+/**
+ * Axis-aligned bounding box hierarchy over the sides of the elements on one boundary (i.e. the
+ * master faces of a contact pair) for finding the faces that are within a distance of a point.
+ *
+ * The tree is built once from the face locations and then refitted when the mesh moves: the boxes
+ * are recomputed from the current node locations but the tree structure is kept, which still
+ * gives correct (if less tight) results for any deformation.
+ */
+class FaceBoundingVolumeHierarchy
+{
+public:
+  /**
+   * Builds the hierarchy over the sides in the side list (see MooseMesh::buildSideList()) that
+   * are on boundary
+   */
+  FaceBoundingVolumeHierarchy(const MooseMesh & mesh,
+                              const std::vector<dof_id_type> & elem_list,
+                              const std::vector<unsigned short int> & side_list,
+                              const std::vector<boundary_id_type> & id_list,
+                              BoundaryID boundary);
+
+  /**
+   * Updates the boxes to the current node locations
+   */
+  void refit();
+
+  /**
+   * Finds the faces that may have a point within radius of p
+   *
+   * @param faces Filled with the indices of those faces in ascending order
+   */
+  void findFaces(const Point & p, Real radius, std::vector<unsigned int> & faces) const;
+
+  /// Number of faces in the hierarchy
+  unsigned int nFaces() const { return _face_elems.size(); }
+
+  /// The element of a face
+  const Elem * elem(unsigned int face) const { return _face_elems[face]; }
+
+  /// The side number of a face in its element
+  unsigned short int side(unsigned int face) const { return _face_sides[face]; }
+
+protected:
+  /// Recursively builds the tree node for the faces _order[begin] to _order[end - 1]
+  unsigned int build(const std::vector<Point> & centroids, unsigned int begin, unsigned int end);
+
+  /// Squared distance from p to the closest point of box
+  static Real distanceSquared(const BoundingBox & box, const Point & p);
+
+  /// Node of the tree, the children of a node always come after it in _tree
+  struct TreeNode
+  {
+    BoundingBox _box;
+
+    /// Range of the faces below this node in _order
+    unsigned int _begin;
+    unsigned int _end;
+
+    /// Indices of the children in _tree, the root can't be a child so 0 means this is a leaf
+    unsigned int _left;
+    unsigned int _right;
+  };
+
+  /// Element and side number of each face
+  std::vector<const Elem *> _face_elems;
+  std::vector<unsigned short int> _face_sides;
+
+  /// Nodes of each face, the nodes of face i are _face_nodes[_face_node_offsets[i]] onwards
+  std::vector<unsigned int> _face_node_offsets;
+  std::vector<const Node *> _face_nodes;
+
+  /// Whether the face may be curved and its nodes don't bound it
+  std::vector<bool> _face_curved;
+
+  /// Current bounding box of each face
+  std::vector<BoundingBox> _face_boxes;
+
+  /// Face indices ordered such that each tree node holds a contiguous range
+  std::vector<unsigned int> _order;
+
+  std::vector<TreeNode> _tree;
+
+  /// Faces per leaf
+  static const unsigned int _max_leaf_size = 4;
+};
+
+#endif // FACEBOUNDINGVOLUMEHIERARCHY_H
@@ -91,6 +91,19 @@ public:
    */
   Real maxPatchPercentage();
 
+  /**
+   * Number of slave nodes owned by this processor whose nearest node search was skipped during
+   * the last update because the nodes could not have moved far enough to change the result.
+   */
+  unsigned int numSkippedNearestNodeSearches();
+
+  /**
+   * Whether the PenetrationLocators find the candidate master faces with a bounding volume
+   * hierarchy (defaults to Mesh/penetration_bounding_volume_hierarchy)
+   */
+  void setUseBoundingVolumeHierarchy(bool use) { _use_bounding_volume_hierarchy = use; }
+  bool useBoundingVolumeHierarchy() const { return _use_bounding_volume_hierarchy; }
+
   /**
    * Updates the list of ghosted elements at the start of each time step for the nonlinear
    * iteration patch update strategy.
@@ -105,6 +118,9 @@ public:
   std::map<unsigned int, std::shared_ptr<ElementPairLocator>> _element_pair_locators;
 
 protected:
+  /// Whether the PenetrationLocators use a bounding volume hierarchy
+  bool _use_bounding_volume_hierarchy;
+
   /// These are _real_ boundaries that have quadrature nodes on them.
   std::set<unsigned int> _quadrature_boundaries;
 
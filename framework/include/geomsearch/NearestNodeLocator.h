@@ -13,9 +13,15 @@
 // Moose
 #include "Restartable.h"
 
+#include "libmesh/point.h"
+
+// C++ includes
+#include <memory>
+
 // Forward declarations
 class SubProblem;
 class MooseMesh;
+class KDTree;
 
 /**
  * Finds the nearest node to each node in boundary1 to each node in boundary2 and the other way
@@ -75,6 +81,13 @@ public:
    */
   void updateGhostedElems();
 
+  /**
+   * Number of slave nodes owned by this processor whose search was skipped by the last
+   * findNodes() because their nearest node could not have changed (only with
+   * Mesh/incremental_nearest_node_search).
+   */
+  unsigned int numSkippedSearches() const { return _num_skipped_searches; }
+
   /**
    * Data structure used to hold nearest node info.
    */
@@ -85,9 +98,57 @@ public:
 
     const Node * _nearest_node;
     Real _distance;
+
+    /// Distance to the second nearest node of the patch
+    Real _second_distance;
+
+    /// How far through the patch the nearest node is
+    Real _patch_percentage;
   };
 
 protected:
+  /**
+   * Makes sure _kd_tree holds trial_master_nodes. In incremental mode the existing tree is kept
+   * if it holds the same nodes, otherwise it is rebuilt from their current locations.
+   *
+   * @param trial_master_nodes The master nodes to search
+   * @param master_points Filled with the current locations of trial_master_nodes
+   * @return How far any master node moved at most since the tree was built
+   */
+  Real updateTree(const std::vector<dof_id_type> & trial_master_nodes,
+                  std::vector<Point> & master_points);
+
+  /// Largest distance a master node moved since _master_reference was taken
+  Real maxMasterDisplacement() const;
+
+  /**
+   * Remembers where the slave nodes of infos were for their search, for deciding whether the
+   * search needs to be redone later
+   */
+  void saveSearchStates(const std::map<dof_id_type, NearestNodeInfo> & infos,
+                        Real master_displacement);
+
+  /**
+   * Marks the tree for rebuilding if the searches through it had to check too many nodes because
+   * of how far the master nodes moved
+   */
+  void checkTreeEfficiency(std::size_t n_candidates, std::size_t n_searches, unsigned int patch_size);
+
+  /**
+   * What is remembered about the last search of a slave node
+   */
+  struct SearchState
+  {
+    /// Location of the slave node
+    Point _slave_position;
+
+    /// Value of maxMasterDisplacement()
+    Real _master_displacement;
+
+    /// Difference of the distances to the second nearest and nearest node
+    Real _gap;
+  };
+
   SubProblem & _subproblem;
 
   MooseMesh & _mesh;
@@ -116,6 +177,30 @@ public:
 
   // The list of ghosted elements added during a time step for iteration patch update strategy
   std::vector<dof_id_type> _new_ghosted_elems;
+
+protected:
+  /// Whether the KD-tree and search results are reused across updates
+  const bool _incremental;
+
+  /// The master nodes in the KD-tree and their locations when it was built
+  std::vector<dof_id_type> _tree_master_nodes;
+  std::vector<Point> _tree_points;
+  std::unique_ptr<KDTree> _kd_tree;
+
+  /// MooseMesh::changeCount() when the tree was built
+  unsigned int _tree_mesh_change_count;
+
+  /// Whether the searches through the tree became slow enough to rebuild it
+  bool _rebuild_tree;
+
+  /// All master nodes and their locations when the tree was built
+  std::vector<std::pair<const Node *, Point>> _master_reference;
+
+  /// The last search of each slave node in incremental mode
+  std::map<dof_id_type, SearchState> _search_states;
+
+  /// Number of searches skipped by the last findNodes()
+  unsigned int _num_skipped_searches;
 };
 
 #endif // NEARESTNODELOCATOR_H
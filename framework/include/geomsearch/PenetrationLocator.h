@@ -18,11 +18,15 @@
 #include "libmesh/point.h"
 #include "libmesh/fe_base.h"
 
+// C++ includes
+#include <memory>
+
 // Forward Declarations
 class SubProblem;
 class MooseMesh;
 class GeometricSearchData;
 class NearestNodeLocator;
+class FaceBoundingVolumeHierarchy;
 
 class PenetrationLocator : Restartable
 {
@@ -53,6 +57,7 @@ public:
   };
 
   SubProblem & _subproblem;
+  GeometricSearchData & _geom_search_data;
 
   Real normDistance(const Elem & elem,
                     const Elem & side,
@@ -99,6 +104,12 @@ protected:
   NORMAL_SMOOTHING_METHOD _normal_smoothing_method;
 
   const Moose::PatchUpdateType _patch_update_strategy; // Contact patch update strategy
+
+  /// Hierarchy of the master faces, if GeometricSearchData::useBoundingVolumeHierarchy()
+  std::unique_ptr<FaceBoundingVolumeHierarchy> _face_bvh;
+
+  /// MooseMesh::changeCount() when _face_bvh was built
+  unsigned int _face_bvh_mesh_change_count;
 };
 
 /**
@@ -15,6 +15,7 @@
 #include "PenetrationLocator.h"
 
 // Forward declarations
+class FaceBoundingVolumeHierarchy;
 template <typename>
 class MooseVariableField;
 typedef MooseVariableField<Real> MooseVariable;
@@ -40,7 +41,8 @@ public:
                     const std::map<dof_id_type, std::vector<dof_id_type>> & node_to_elem_map,
                     std::vector<dof_id_type> & elem_list,
                     std::vector<unsigned short int> & side_list,
-                    std::vector<boundary_id_type> & id_list);
+                    std::vector<boundary_id_type> & id_list,
+                    const FaceBoundingVolumeHierarchy * face_bvh = NULL);
 
   // Splitting Constructor
   PenetrationThread(PenetrationThread & x, Threads::split split);
@@ -86,6 +88,10 @@ protected:
 
   unsigned int _n_elems;
 
+  /// Hierarchy of the master faces for finding the candidate faces, NULL to use the faces
+  /// connected to the nearest node
+  const FaceBoundingVolumeHierarchy * _face_bvh;
+
   THREAD_ID _tid;
 
   enum CompeteInteractionResult
@@ -158,6 +164,19 @@ protected:
                          const std::vector<const Node *> & nodes_that_must_be_on_side,
                          const bool check_whether_reasonable = false);
 
+  /**
+   * Finds the contact point of slave_node on a side of elem and adds the new info to p_info.
+   * Takes ownership of side.
+   *
+   * @return The new info or NULL if check_whether_reasonable rejected the side
+   */
+  PenetrationInfo * createInfoForSide(std::vector<PenetrationInfo *> & p_info,
+                                      const Node * slave_node,
+                                      const Elem * elem,
+                                      unsigned int side_num,
+                                      const Elem * side,
+                                      const bool check_whether_reasonable);
+
   void getSidesOnMasterBoundary(std::vector<unsigned int> & sides, const Elem * const elem);
 
   void computeSlip(FEBase & fe, PenetrationInfo & info);
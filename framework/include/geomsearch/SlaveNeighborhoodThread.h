@@ -14,6 +14,7 @@
 #include "MooseTypes.h"
 #include "NearestNodeLocator.h"
 #include "KDTree.h"
+#include "CompressedRowTable.h"
 
 // Forward declarations
 class MooseMesh;
@@ -27,9 +28,11 @@ public:
 
   SlaveNeighborhoodThread(const MooseMesh & mesh,
                           const std::vector<dof_id_type> & trial_master_nodes,
-                          const std::map<dof_id_type, std::vector<dof_id_type>> & node_to_elem_map,
+                          const CompressedRowTable<dof_id_type> & node_to_elem_table,
                           const unsigned int patch_size,
-                          KDTree & _kd_tree);
+                          KDTree & _kd_tree,
+                          const std::vector<Point> & master_points,
+                          Real max_master_displacement);
 
   /// Splitting Constructor
   SlaveNeighborhoodThread(SlaveNeighborhoodThread & x, Threads::split split);
@@ -47,6 +50,9 @@ public:
   /// Elements that we need to ghost
   std::set<dof_id_type> _ghosted_elems;
 
+  /// Number of master nodes checked by the KD-tree searches
+  std::size_t _n_candidates;
+
 protected:
   /// The Mesh
   const MooseMesh & _mesh;
@@ -54,11 +60,17 @@ protected:
   /// Nodes to search against
   const std::vector<dof_id_type> & _trial_master_nodes;
 
-  /// Node to elem map
-  const std::map<dof_id_type, std::vector<dof_id_type>> & _node_to_elem_map;
+  /// Node to elem table
+  const CompressedRowTable<dof_id_type> & _node_to_elem_table;
 
   /// The number of nodes to keep
   unsigned int _patch_size;
+
+  /// Current locations of the trial master nodes
+  const std::vector<Point> & _master_points;
+
+  /// How far the master nodes moved at most since the KD-tree was built from their locations
+  const Real _max_master_displacement;
 };
 
 #endif // SLAVENEIGHBORHOODTHREAD_H
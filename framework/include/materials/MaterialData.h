@@ -136,6 +136,9 @@ public:
     return _storage.getPropertyId(prop_name);
   }
 
+  /// The slab locations already resolved for this object, see MaterialPropertyStorage::swap()
+  MaterialPropertyStorage::SlabCache & slabCache() { return _slab_cache; }
+
 protected:
   /// Reference to the MaterialStorage class
   MaterialPropertyStorage & _storage;
@@ -161,6 +164,9 @@ protected:
   /// Status of storage swapping (calling swap sets this to true; swapBack sets it to false)
   bool _swapped;
 
+  /// Slab locations resolved by swap(), so that it does not need to lock the shared storage
+  MaterialPropertyStorage::SlabCache _slab_cache;
+
 private:
   template <typename T>
   MaterialProperty<T> &
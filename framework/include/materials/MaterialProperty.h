@@ -62,6 +62,22 @@ public:
 
   virtual void swap(PropertyValue * rhs) = 0;
 
+  /**
+   * Make this property operate on a window of the values held by a slab property, setting
+   * aside its own values until swapBackSlab() is called.
+   *
+   * @param slab The property holding the contiguous values
+   * @param offset The index of the first value within the slab
+   * @param n The number of values (quadrature points) in the window
+   */
+  virtual void swapSlab(PropertyValue * slab, unsigned int offset, unsigned int n) = 0;
+
+  /**
+   * Undo swapSlab() and restore the values of this property. Does nothing if this property is
+   * not currently swapped into a slab.
+   */
+  virtual void swapBackSlab() = 0;
+
   /**
    * Copy the value of a Property from one specific to a specific qp in this Property.
    *
@@ -100,9 +116,13 @@ class MaterialProperty : public PropertyValue
 {
 public:
   /// Explicitly declare a public constructor because we made the copy constructor private
-  MaterialProperty() : PropertyValue() { /* */}
+  MaterialProperty() : PropertyValue(), _in_slab(false) { /* */}
 
-  virtual ~MaterialProperty() { _value.release(); }
+  virtual ~MaterialProperty()
+  {
+    swapBackSlab();
+    _value.release();
+  }
 
   /**
    * @returns a read-only reference to the parameter value.
@@ -146,6 +166,10 @@ public:
    */
   virtual void swap(PropertyValue * rhs);
 
+  virtual void swapSlab(PropertyValue * slab, unsigned int offset, unsigned int n);
+
+  virtual void swapBackSlab();
+
   /**
    * Copy the value of a Property from one specific to a specific qp in this Property.
    *
@@ -198,6 +222,12 @@ private:
 
   /// Stored parameter value.
   MooseArray<T> _value;
+
+  /// Own values set aside while _value refers to a window of a slab (see swapSlab())
+  MooseArray<T> _stash;
+
+  /// Whether _value currently refers to a window of a slab
+  bool _in_slab;
 };
 
 // ------------------------------------------------------------
@@ -231,6 +261,31 @@ MaterialProperty<T>::swap(PropertyValue * rhs)
   _value.swap(cast_ptr<MaterialProperty<T> *>(rhs)->_value);
 }
 
+template <typename T>
+inline void
+MaterialProperty<T>::swapSlab(PropertyValue * slab, unsigned int offset, unsigned int n)
+{
+  mooseAssert(slab != NULL, "Swapping with NULL?");
+  mooseAssert(!_in_slab, "Material property is already swapped into a slab");
+
+  _stash.swap(_value);
+  _value.shallowCopy(cast_ptr<MaterialProperty<T> *>(slab)->_value, offset, n);
+  _in_slab = true;
+}
+
+template <typename T>
+inline void
+MaterialProperty<T>::swapBackSlab()
+{
+  if (!_in_slab)
+    return;
+
+  // The slab owns the window, so just forget about it before getting our own values back
+  _value.shallowCopy(MooseArray<T>());
+  _value.swap(_stash);
+  _in_slab = false;
+}
+
 template <typename T>
 inline void
 MaterialProperty<T>::qpCopy(const unsigned int to_qp,
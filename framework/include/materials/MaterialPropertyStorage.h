@@ -12,11 +12,15 @@
 
 #include "Moose.h"
 #include "MaterialProperty.h"
-#include "HashMap.h"
+
+#include <array>
+#include <atomic>
+#include <unordered_map>
 
 // Forward declarations
 class Material;
 class MaterialData;
+class MooseMesh;
 class QpMap;
 
 // libMesh forward declarations
@@ -28,6 +32,10 @@ class QBase;
 /**
  * Stores the stateful material properties computed by materials.
  *
+ * Each stateful property is stored as a few large contiguous slabs (chunks) per state that are
+ * indexed by element and side, instead of a separate property object per element.
+ * MaterialData operates directly on windows of these slabs while swapped.
+ *
  * Thread-safe
  */
 class MaterialPropertyStorage
@@ -148,7 +156,7 @@ public:
 
   /**
    * Swap (shallow copy) material properties in MaterialData and MaterialPropertyStorage
-   * Thread safe
+   * Thread safe, the lock is only taken when the SlabCache of material_data misses
    * @param material_data MaterialData object to work with
    * @param elem Element id
    * @param side Side number (elemental material properties have this equal to zero)
@@ -174,49 +182,75 @@ public:
    */
   bool hasOlderProperties() const { return _has_older_prop; }
 
-  ///@{
   /**
-   * Access methods to the stored material property data
-   *
+   * Location of the stateful property values of one element side within the slabs. The values
+   * of every stateful property (and every state) for this element side live in chunk "chunk" at
+   * quadrature points [offset, offset + n_qpoints).
    */
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>> & props()
-  {
-    return *_props_elem;
-  }
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>> & propsOld()
-  {
-    return *_props_elem_old;
-  }
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>> & propsOlder()
-  {
-    return *_props_elem_older;
-  }
-  const HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>> & props() const
-  {
-    return *_props_elem;
-  }
-  const HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>> & propsOld() const
-  {
-    return *_props_elem_old;
-  }
-  const HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>> & propsOlder() const
-  {
-    return *_props_elem_older;
-  }
-  MaterialProperties & props(const Elem * elem, unsigned int side)
-  {
-    return (*_props_elem)[elem][side];
-  }
-  MaterialProperties & propsOld(const Elem * elem, unsigned int side)
+  struct SlabEntry
   {
-    return (*_props_elem_old)[elem][side];
-  }
-  MaterialProperties & propsOlder(const Elem * elem, unsigned int side)
+    SlabEntry() : chunk(libMesh::invalid_uint), offset(0), n_qpoints(0) {}
+
+    bool allocated() const { return chunk != libMesh::invalid_uint; }
+
+    unsigned int chunk;
+    unsigned int offset;
+    unsigned int n_qpoints;
+  };
+
+  /**
+   * The slab locations and slab pointers already resolved by one thread, so that swap() only
+   * takes the lock the first time it sees an element side or a chunk. Every MaterialData holds
+   * one; its contents are dropped whenever the storage changes in a way that could make them stale.
+   */
+  struct SlabCache
   {
-    return (*_props_elem_older)[elem][side];
-  }
+    SlabCache() : generation(libMesh::invalid_uint) {}
+
+    /// The generation of the storage the contents were resolved in
+    unsigned int generation;
+
+    /// indexing: [element][side] -> location of the properties within the slabs
+    std::unordered_map<const Elem *, std::vector<SlabEntry>> entries;
+
+    /// indexing: [chunk][slab set * number of stateful properties + stateful property]
+    std::vector<std::vector<PropertyValue *>> slabs;
+  };
+
+  /**
+   * Returns the slab location of the stateful properties on the given element side. The entry is
+   * not allocated() if no storage has been initialized for it yet. Thread safe.
+   */
+  SlabEntry entry(const Elem & elem, unsigned int side) const;
+
+  ///@{
+  /**
+   * Access methods to the stored material property data. Each returns the property holding the
+   * contiguous values of the given stateful property (index into statefulProps()) for one chunk,
+   * or nullptr if that chunk was never initialized for the property. Thread safe.
+   */
+  PropertyValue * props(unsigned int stateful_id, unsigned int chunk) const;
+  PropertyValue * propsOld(unsigned int stateful_id, unsigned int chunk) const;
+  PropertyValue * propsOlder(unsigned int stateful_id, unsigned int chunk) const;
   ///@}
 
+  /**
+   * Total number of quadrature points allocated across all chunks (per property and state)
+   */
+  std::size_t slabSize() const;
+
+  /**
+   * Write the stored stateful property values to a binary stream (used for restart)
+   */
+  void store(std::ostream & stream);
+
+  /**
+   * Read the stateful property values written by store(). Storage is created for element sides
+   * that do not have any yet, such as inactive parents kept after adaptivity. The values of
+   * elements that are not in this processor's part of the mesh are skipped.
+   */
+  void load(std::istream & stream, const MooseMesh & mesh);
+
   bool hasProperty(const std::string & prop_name) const;
 
   /// The addProperty functions are idempotent - calling multiple times with
@@ -240,11 +274,47 @@ public:
   }
 
 protected:
-  // indexing: [element][side]->material_properties
-  std::unique_ptr<HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>>> _props_elem;
-  std::unique_ptr<HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>>> _props_elem_old;
-  std::unique_ptr<HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>>>
-      _props_elem_older;
+  /// Minimum number of quadrature points held by each slab chunk
+  static const unsigned int _slab_chunk_size = 4096;
+
+  /**
+   * Returns the slab holding the given state (0 = current, 1 = old, 2 = older) of a stateful
+   * property in a chunk, or nullptr if it doesn't exist. The slab vectors grow in initProps(), so
+   * inside threaded loops this must be called while holding Threads::spin_mtx.
+   */
+  PropertyValue * slab(unsigned int state, unsigned int stateful_id, unsigned int chunk) const
+  {
+    const auto & slabs = _slabs[_state_to_slabs[state]];
+    if (stateful_id >= slabs.size() || chunk >= slabs[stateful_id].size())
+      return nullptr;
+    return slabs[stateful_id][chunk];
+  }
+
+  /// indexing: [element][side] -> location of the properties within the slabs
+  std::unordered_map<const Elem *, std::vector<SlabEntry>> _slab_index;
+
+  /**
+   * The slabs: indexing: [slab set][stateful property][chunk]. Every chunk is a single property
+   * object whose values are contiguous. Chunks never move once created, so views into them stay
+   * valid while other threads add more elements.
+   */
+  std::vector<std::vector<PropertyValue *>> _slabs[3];
+
+  /// Maps the current, old and older states onto the slab sets; shift() just rotates this
+  std::array<unsigned int, 3> _state_to_slabs;
+
+  /// Number of quadrature points each chunk can hold
+  std::vector<unsigned int> _chunk_capacity;
+
+  /// Number of quadrature points already handed out from the last chunk
+  unsigned int _last_chunk_fill;
+
+  /// Ranges abandoned when the number of quadrature points of an entry changed, for reuse.
+  /// indexing: [number of quadrature points] -> (chunk, offset) of the free ranges of that size
+  std::unordered_map<unsigned int, std::vector<std::pair<unsigned int, unsigned int>>> _free_ranges;
+
+  /// Changed whenever slab entries move or chunks are created, which invalidates every SlabCache
+  std::atomic<unsigned int> _generation;
 
   /// mapping from property name to property ID
   /// NOTE: this is static so the property numbering is global within the simulation (not just FEProblemBase - should be useful when we will use material properties from
@@ -268,37 +338,49 @@ protected:
   /// the vector of stateful property ids (the vector index is the map to stateful prop_id)
   std::vector<unsigned int> _stateful_prop_id_to_prop_id;
 
-  void sizeProps(MaterialProperties & mp, unsigned int size);
-
 private:
-  /// Initializes hashmap entries for element and side to proper qpoint and
-  /// property count sizes.
-  void initProps(MaterialData & material_data,
-                 const Elem & elem,
-                 unsigned int side,
-                 unsigned int n_qpoints);
+  /// Same as entry(), but without locking
+  SlabEntry lookup(const Elem & elem, unsigned int side) const;
+
+  /**
+   * Hands out n_qpoints contiguous quadrature points of the slabs for the element side, unless it
+   * already has that many. The caller must hold Threads::spin_mtx.
+   */
+  SlabEntry & reserveEntry(const Elem & elem, unsigned int side, unsigned int n_qpoints);
+
+  /// Any existing chunk of the given stateful property (in any state), or nullptr if there is none
+  PropertyValue * prototype(unsigned int stateful_id) const;
+
+  /// Initializes the slab entry for element and side to proper qpoint and
+  /// property count sizes and returns it.
+  SlabEntry initProps(MaterialData & material_data,
+                      const Elem & elem,
+                      unsigned int side,
+                      unsigned int n_qpoints);
+
+  /// Copies all states of all stateful properties between two slab entries
+  void copySlabs(MaterialPropertyStorage & from_storage,
+                 const SlabEntry & to,
+                 unsigned int to_qp,
+                 const SlabEntry & from,
+                 unsigned int from_qp);
 };
 
 template <>
 inline void
-dataStore(std::ostream & stream, MaterialPropertyStorage & storage, void * context)
+dataStore(std::ostream & stream, MaterialPropertyStorage & storage, void * /*context*/)
 {
-  dataStore(stream, storage.props(), context);
-  dataStore(stream, storage.propsOld(), context);
-
-  if (storage.hasOlderProperties())
-    dataStore(stream, storage.propsOlder(), context);
+  storage.store(stream);
 }
 
 template <>
 inline void
 dataLoad(std::istream & stream, MaterialPropertyStorage & storage, void * context)
 {
-  dataLoad(stream, storage.props(), context);
-  dataLoad(stream, storage.propsOld(), context);
+  if (!context)
+    mooseError("Can only load MaterialPropertyStorage objects using a MooseMesh context!");
 
-  if (storage.hasOlderProperties())
-    dataLoad(stream, storage.propsOlder(), context);
+  storage.load(stream, *static_cast<MooseMesh *>(context));
 }
 
 #endif /* MATERIALPROPERTYSTORAGE_H */
@@ -15,6 +15,8 @@
 #include "BndElement.h"
 #include "Restartable.h"
 #include "MooseEnum.h"
+#include "FuzzyPointIndex.h"
+#include "CompressedRowTable.h"
 
 #include <memory> //std::unique_ptr
 
@@ -155,6 +157,45 @@ public:
    */
   const std::map<dof_id_type, std::vector<dof_id_type>> & nodeToActiveSemilocalElemMap();
 
+  ///@{
+  /**
+   * Same as nodeToElemMap() and nodeToActiveSemilocalElemMap(), but stored in compressed row
+   * format which needs a fraction of the memory and is built using threads. The elements of each
+   * node are sorted by id.
+   */
+  const CompressedRowTable<dof_id_type> & nodeToElemTable() const;
+  const CompressedRowTable<dof_id_type> & nodeToActiveSemilocalElemTable() const;
+  ///@}
+
+  /**
+   * Rebuilds the tables returned by nodeToElemTable() and nodeToActiveSemilocalElemTable(). This
+   * is done whenever the mesh changes and has to be done after adding quadrature nodes with
+   * addQuadratureNode(). It must not be called from within a threaded loop.
+   */
+  void buildNodeToElemTables();
+
+  /**
+   * Returns the ids of the boundaries each boundary node is on (including quadrature nodes)
+   */
+  const CompressedRowTable<BoundaryID> & nodeToBoundaryTable() const;
+
+  /**
+   * Rebuilds the table returned by nodeToBoundaryTable(). This is done whenever the mesh changes
+   * and has to be done after adding quadrature nodes with addQuadratureNode(). It must not be
+   * called from within a threaded loop.
+   */
+  void buildNodeToBoundaryTable();
+
+  /**
+   * Returns the ids of the boundaries on the sides of each boundary element
+   */
+  const CompressedRowTable<BoundaryID> & elemToBoundaryTable() const { return _elem_to_bnd_ids; }
+
+  /**
+   * Returns the ids of the blocks of the elements connected to each node
+   */
+  const CompressedRowTable<SubdomainID> & nodeToBlockTable() const { return _node_block_ids; }
+
   /**
    * These structs are required so that the bndNodes{Begin,End} and
    * bndElems{Begin,End} functions work...
@@ -269,6 +310,12 @@ public:
    */
   void meshChanged();
 
+  /**
+   * Returns the number of times meshChanged() has been called, so that clients can tell whether
+   * data they cached for this mesh is still valid.
+   */
+  unsigned int changeCount() const { return _change_count; }
+
   /**
    * Declares a callback function that is executed at the conclusion
    * of meshChanged(). Ther user can implement actions required after
@@ -435,6 +482,20 @@ public:
    * Getter for the maximum leaf size parameter.
    */
   unsigned int getMaxLeafSize() const { return _max_leaf_size; };
+
+  /**
+   * Getter for the incremental_nearest_node_search parameter.
+   */
+  bool incrementalNearestNodeSearch() const { return _incremental_nearest_node_search; }
+
+  /**
+   * Getter for the penetration_bounding_volume_hierarchy parameter.
+   */
+  bool penetrationBoundingVolumeHierarchy() const
+  {
+    return _penetration_bounding_volume_hierarchy;
+  }
+
   /**
    * Set the patch size update strategy
    */
@@ -478,7 +539,7 @@ public:
   /**
    * Return list of blocks to which the given node belongs.
    */
-  const std::set<SubdomainID> & getNodeBlockIds(const Node & node) const;
+  CompressedRowTable<SubdomainID>::Row getNodeBlockIds(const Node & node) const;
 
   /**
    * Return a writable reference to a vector of node IDs that belong
@@ -866,6 +927,9 @@ protected:
   /// true if mesh is changed (i.e. after adaptivity step)
   bool _is_changed;
 
+  /// Number of calls to meshChanged()
+  unsigned int _change_count;
+
   /// True if a Nemesis Mesh was read in
   bool _is_nemesis;
 
@@ -912,6 +976,12 @@ protected:
   std::map<dof_id_type, std::vector<dof_id_type>> _node_to_active_semilocal_elem_map;
   bool _node_to_active_semilocal_elem_map_built;
 
+  /// Compressed row versions of the two maps above
+  CompressedRowTable<dof_id_type> _node_to_elem_table;
+  bool _node_to_elem_table_built;
+  CompressedRowTable<dof_id_type> _node_to_active_semilocal_elem_table;
+  bool _node_to_active_semilocal_elem_table_built;
+
   /**
    * A set of subdomain IDs currently present in the mesh. For parallel meshes, includes subdomains
    * defined on other processors as well.
@@ -936,23 +1006,25 @@ protected:
   std::vector<BndNode *> _bnd_nodes;
   typedef std::vector<BndNode *>::iterator bnd_node_iterator_imp;
   typedef std::vector<BndNode *>::const_iterator const_bnd_node_iterator_imp;
-  /// Map of sets of node IDs in each boundary
-  std::map<boundary_id_type, std::set<dof_id_type>> _bnd_node_ids;
+  /// Boundary IDs of each boundary node, rebuilt after quadrature nodes were added
+  CompressedRowTable<BoundaryID> _node_to_bnd_ids;
+  /// Whether _node_to_bnd_ids includes all the boundary nodes
+  bool _node_to_bnd_ids_built;
 
   /// array of boundary elems
   std::vector<BndElement *> _bnd_elems;
   typedef std::vector<BndElement *>::iterator bnd_elem_iterator_imp;
   typedef std::vector<BndElement *>::const_iterator const_bnd_elem_iterator_imp;
-  /// Map of set of elem IDs connected to each boundary
-  std::map<boundary_id_type, std::set<dof_id_type>> _bnd_elem_ids;
+  /// Boundary IDs of the sides of each boundary element
+  CompressedRowTable<BoundaryID> _elem_to_bnd_ids;
 
   std::map<dof_id_type, Node *> _quadrature_nodes;
   std::map<dof_id_type, std::map<unsigned int, std::map<dof_id_type, Node *>>>
       _elem_to_side_to_qp_to_quadrature_nodes;
   std::vector<BndNode> _extra_bnd_nodes;
 
-  /// list of nodes that belongs to a specified block (domain)
-  std::map<dof_id_type, std::set<SubdomainID>> _block_node_list;
+  /// Blocks (domains) each node belongs to
+  CompressedRowTable<SubdomainID> _node_block_ids;
 
   /// list of nodes that belongs to a specified nodeset: indexing [nodeset_id] -> [array of node ids]
   std::map<boundary_id_type, std::vector<dof_id_type>> _node_set_nodes;
@@ -969,12 +1041,21 @@ protected:
   // The maximum number of points in each leaf of the KDTree used in the nearest neighbor search.
   unsigned int _max_leaf_size;
 
+  /// Whether the NearestNodeLocators reuse their KD-tree and search results across updates
+  bool _incremental_nearest_node_search;
+
+  /// Whether the PenetrationLocators find the candidate faces with a bounding volume hierarchy
+  bool _penetration_bounding_volume_hierarchy;
+
   /// The patch update strategy
   Moose::PatchUpdateType _patch_update_strategy;
 
   /// Vector of all the Nodes in the mesh for determining when to add a new point
   std::vector<Node *> _node_map;
 
+  /// Spatial hash of the points in _node_map (same indices) for finding coincident nodes
+  FuzzyPointIndex _node_index;
+
   /// Boolean indicating whether this mesh was detected to be regular and orthogonal
   bool _regular_orthogonal_mesh;
 
@@ -994,6 +1075,13 @@ protected:
   void freeBndNodes();
   void freeBndElems();
 
+  /**
+   * Appends the (node id, element id) pairs of the nodes of elem, including the quadrature nodes
+   * created on its sides, for building the node to element tables
+   */
+  void nodeToElemEntries(const Elem * elem,
+                         std::vector<std::pair<dof_id_type, dof_id_type>> & entries) const;
+
 private:
   /**
    * A map of vectors indicating which dimensions are periodic in a regular orthogonal mesh for
@@ -14,6 +14,9 @@
 #include "SetupInterface.h"
 #include "Restartable.h"
 
+// C++ includes
+#include <chrono>
+
 class MultiApp;
 class UserObject;
 class FEProblemBase;
@@ -279,7 +282,34 @@ public:
    */
   bool isRootProcessor() { return _my_rank == 0; }
 
+  /**
+   * Gathers the measured solve time of every App, reports the load imbalance between the
+   * processors and writes the times to the 'output_app_costs' file, where they can be used as
+   * 'app_costs_file' to rebalance the Apps when the simulation is restarted.
+   *
+   * This must be called on all processors and does nothing unless 'output_app_costs' is given.
+   */
+  void writeAppCosts();
+
 protected:
+  /**
+   * Adds the wall time between its construction and destruction to the measured cost of an App
+   */
+  class AppSolveTimer
+  {
+  public:
+    AppSolveTimer(Real & cost) : _cost(cost), _start(std::chrono::steady_clock::now()) {}
+
+    ~AppSolveTimer()
+    {
+      _cost += std::chrono::duration<Real>(std::chrono::steady_clock::now() - _start).count();
+    }
+
+  private:
+    Real & _cost;
+    const std::chrono::steady_clock::time_point _start;
+  };
+
   /**
    * _must_ fill in _positions with the positions of the sub-aps
    */
@@ -300,6 +330,18 @@ protected:
    */
   void buildComm();
 
+  /**
+   * Distribute the Apps and processors according to _app_costs: contiguous ranges of Apps with
+   * about the same total cost when there are more Apps than processors, otherwise a number of
+   * processors proportional to the cost of each App.
+   */
+  void buildBalancedComm();
+
+  /**
+   * Fill _app_costs from 'app_costs' or 'app_costs_file', it stays empty if neither is given.
+   */
+  void readAppCosts();
+
   /**
    * Map a global App number to the local number.
    * Note: This will error if given a global number that doesn't map to a local number.
@@ -402,6 +444,12 @@ protected:
 
   /// Backups for each local App
   SubAppBackups & _backups;
+
+  /// The estimated cost of every App used to balance them over the processors (empty if unknown)
+  std::vector<Real> _app_costs;
+
+  /// The measured solve time of each local App
+  std::vector<Real> _app_solve_times;
 };
 
 template <>
@@ -415,6 +463,12 @@ dataStore(std::ostream & stream, SubAppBackups & backups, void * context)
   if (!multi_app)
     mooseError("Error storing std::vector<Backup*>");
 
+  // Record which Apps the backups belong to so that recover can check the distribution
+  unsigned int first_local_app = multi_app->firstLocalApp();
+  unsigned int num_local_apps = backups.size();
+  dataStore(stream, first_local_app, nullptr);
+  dataStore(stream, num_local_apps, nullptr);
+
   for (unsigned int i = 0; i < backups.size(); i++)
     dataStore(stream, backups[i], context);
 }
@@ -428,6 +482,26 @@ dataLoad(std::istream & stream, SubAppBackups & backups, void * context)
   if (!multi_app)
     mooseError("Error loading std::vector<Backup*>");
 
+  // The backups are restored by local index, so the Apps must be distributed as they were
+  unsigned int first_local_app = 0;
+  unsigned int num_local_apps = 0;
+  dataLoad(stream, first_local_app, nullptr);
+  dataLoad(stream, num_local_apps, nullptr);
+  if (first_local_app != multi_app->firstLocalApp() || num_local_apps != backups.size())
+    mooseError("The Apps of MultiApp ",
+               multi_app->name(),
+               " are not distributed over the processors as they were when the checkpoint was "
+               "written (this processor had ",
+               num_local_apps,
+               " Apps starting at ",
+               first_local_app,
+               ", it now has ",
+               backups.size(),
+               " starting at ",
+               multi_app->firstLocalApp(),
+               ").\nRecover with the same 'app_costs' or 'app_costs_file' as the "
+               "checkpointed run.");
+
   for (unsigned int i = 0; i < backups.size(); i++)
     dataLoad(stream, backups[i], context);
 
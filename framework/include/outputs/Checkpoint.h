@@ -15,6 +15,7 @@
 #include "RestartableDataIO.h"
 
 #include <deque>
+#include <future>
 
 // Forward declarations
 class Checkpoint;
@@ -50,6 +51,16 @@ public:
    */
   Checkpoint(const InputParameters & parameters);
 
+  /**
+   * Class destructor, waits for checkpoints still being written in the background
+   */
+  virtual ~Checkpoint();
+
+  /**
+   * Finishes the checkpoints written in the background at the end of the simulation
+   */
+  virtual void outputStep(const ExecFlagType & type) override;
+
   /**
    * Returns the base filename for the checkpoint files
    */
@@ -71,6 +82,16 @@ protected:
 private:
   void updateCheckpointFiles(CheckpointFileNames file_struct);
 
+  /**
+   * Rotates the files of background writes that have completed on all the processors, oldest
+   * first. Waits for the oldest writes while more than max_pending of them are outstanding. This
+   * has to be called on all the processors.
+   */
+  void finishPendingWrites(unsigned int max_pending);
+
+  /// Prints the amount of restartable data written for a checkpoint and the write rate
+  void reportWriteRate(const CheckpointFileNames & file_struct, std::size_t bytes, Real write_time);
+
   /// Max no. of output files to store
   unsigned int _num_files;
 
@@ -80,6 +101,15 @@ private:
   /// True if outputing checkpoint files in binary format
   bool _binary;
 
+  /// True if the amount and rate of restartable data written should be printed
+  const bool _report_write_rate;
+
+  /// True if restartable data is written to disk from a background thread
+  const bool _async;
+
+  /// Maximum number of checkpoints being written in the background at the same time
+  const unsigned int _max_pending_writes;
+
   /// True if running with parallel mesh
   bool _parallel_mesh;
 
@@ -100,6 +130,11 @@ private:
 
   /// Vector of checkpoint filename structures
   std::deque<CheckpointFileNames> _file_names;
+
+  /// Checkpoints still being written in the background (oldest first) with the eventual number
+  /// of bytes written and the time it took
+  std::deque<std::pair<CheckpointFileNames, std::future<std::pair<std::size_t, Real>>>>
+      _pending_writes;
 };
 
 #endif // CHECKPOINT_H
@@ -83,6 +83,9 @@ protected:
 
   /// Enable/disable output of time column for Postprocessors
   bool _time_column;
+
+  /// The number of rows of the postprocessor and scalar tables kept in memory (0 keeps all)
+  const unsigned int _max_rows_in_memory;
 };
 
 #endif /* TABLEOUTPUT_H */
@@ -0,0 +1,45 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef ADAPTIVITYSTATISTICS_H
+#define ADAPTIVITYSTATISTICS_H
+
+#include "GeneralPostprocessor.h"
+
+class AdaptivityStatistics;
+
+template <>
+InputParameters validParams<AdaptivityStatistics>();
+
+/**
+ * Reports the wall time of the last mesh adaptivity step or the growth of the peak memory during
+ * it, maximized over the processors
+ */
+class AdaptivityStatistics : public GeneralPostprocessor
+{
+public:
+  AdaptivityStatistics(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual PostprocessorValue getValue() override;
+
+protected:
+  enum class Statistic
+  {
+    wall_time,
+    peak_memory_growth
+  } _statistic;
+
+  /// The requested statistic of this process
+  Real _value;
+};
+
+#endif // ADAPTIVITYSTATISTICS_H
@@ -0,0 +1,44 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef CACHEDINSERTIONTIME_H
+#define CACHEDINSERTIONTIME_H
+
+#include "GeneralPostprocessor.h"
+
+// Forward Declarations
+class CachedInsertionTime;
+
+template <>
+InputParameters validParams<CachedInsertionTime>();
+
+/**
+ * Reports the wall time the threads have spent adding their cached residual or Jacobian values
+ * to the global vectors and matrices (see Problem/batch_cached_insertion).
+ */
+class CachedInsertionTime : public GeneralPostprocessor
+{
+public:
+  CachedInsertionTime(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+
+  virtual Real getValue() override;
+
+protected:
+  /// Whether to report the time for the Jacobian instead of the residual
+  const bool _jacobian;
+
+  /// Insertion time summed over the threads
+  Real _time;
+};
+
+#endif // CACHEDINSERTIONTIME_H
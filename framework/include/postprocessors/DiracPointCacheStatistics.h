@@ -0,0 +1,46 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef DIRACPOINTCACHESTATISTICS_H
+#define DIRACPOINTCACHESTATISTICS_H
+
+#include "GeneralPostprocessor.h"
+
+class DiracPointCacheStatistics;
+
+template <>
+InputParameters validParams<DiracPointCacheStatistics>();
+
+/**
+ * Reports how many Dirac points added with an ID were found in their cached element, were found
+ * near it, or had to be searched for with the PointLocator since the start of the simulation
+ */
+class DiracPointCacheStatistics : public GeneralPostprocessor
+{
+public:
+  DiracPointCacheStatistics(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual PostprocessorValue getValue() override;
+
+protected:
+  enum class Statistic
+  {
+    hits,
+    relocations,
+    searches
+  } _statistic;
+
+  /// The requested statistic of this process
+  Real _value;
+};
+
+#endif // DIRACPOINTCACHESTATISTICS_H
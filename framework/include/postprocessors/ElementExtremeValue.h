@@ -37,6 +37,7 @@ public:
   ElementExtremeValue(const InputParameters & parameters);
 
   virtual void initialize() override;
+  virtual void finalize() override;
   virtual Real getValue() override;
   virtual void threadJoin(const UserObject & y) override;
 
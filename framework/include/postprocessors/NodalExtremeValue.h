@@ -37,6 +37,7 @@ public:
   NodalExtremeValue(const InputParameters & parameters);
   virtual void initialize() override;
   virtual void execute() override;
+  virtual void finalize() override;
   virtual Real getValue() override;
   virtual void threadJoin(const UserObject & y) override;
 
@@ -28,6 +28,7 @@ public:
 
   virtual void initialize() override;
   virtual void execute() override;
+  virtual void finalize() override;
   virtual Real getValue() override;
 
   void threadJoin(const UserObject & y) override;
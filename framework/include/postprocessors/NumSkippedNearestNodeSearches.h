@@ -0,0 +1,42 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef NUMSKIPPEDNEARESTNODESEARCHES_H
+#define NUMSKIPPEDNEARESTNODESEARCHES_H
+
+#include "GeneralPostprocessor.h"
+
+// Forward Declarations
+class NumSkippedNearestNodeSearches;
+
+template <>
+InputParameters validParams<NumSkippedNearestNodeSearches>();
+
+/**
+ * Reports the number of slave nodes whose nearest node search was skipped during the last
+ * geometric search update because it could not have changed the result (see
+ * Mesh/incremental_nearest_node_search).
+ */
+class NumSkippedNearestNodeSearches : public GeneralPostprocessor
+{
+public:
+  NumSkippedNearestNodeSearches(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+
+  virtual Real getValue() override;
+
+protected:
+  /// Number of skipped searches
+  unsigned int _n_skipped;
+};
+
+#endif // NUMSKIPPEDNEARESTNODESEARCHES_H
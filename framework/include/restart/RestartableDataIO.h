@@ -37,10 +37,29 @@ public:
 
   /**
    * Write out the restartable data.
+   * @return The number of bytes written by this processor
    */
-  void writeRestartableData(std::string base_file_name,
-                            const RestartableDatas & restartable_datas,
-                            std::set<std::string> & _recoverable_data);
+  std::size_t writeRestartableData(std::string base_file_name,
+                                   const RestartableDatas & restartable_datas,
+                                   std::set<std::string> & recoverable_data);
+
+  /**
+   * Serialize the restartable data of every thread into memory, so that it can be written later
+   * (i.e. from a background thread) while the simulation keeps modifying the data.
+   */
+  std::vector<std::shared_ptr<std::stringstream>>
+  snapshotRestartableData(const RestartableDatas & restartable_datas);
+
+  /**
+   * Write a snapshot created by snapshotRestartableData() to the restart files. This only touches
+   * the snapshot and the file system, so it may be called from a background thread. Each file is
+   * written under a temporary name and renamed once complete; throws on failure.
+   * @return The number of bytes written
+   */
+  static std::size_t
+  writeSnapshot(const std::string & base_file_name,
+                processor_id_type proc_id,
+                const std::vector<std::shared_ptr<std::stringstream>> & snapshot);
 
   /**
    * Read restartable data header to verify that we are restarting on the correct number of
@@ -67,6 +86,9 @@ public:
 private:
   /**
    * Serializes the data into the stream object.
+   *
+   * Each value is streamed directly into the output and located through a trailing index of
+   * 64-bit offsets and sizes, so that readers can seek straight to the values they need.
    */
   void serializeRestartableData(
       const std::map<std::string, std::unique_ptr<RestartableDataValue>> & restartable_data,
@@ -80,6 +102,12 @@ private:
       std::istream & stream,
       const std::set<std::string> & recoverable_data);
 
+  /**
+   * Name of the restart file holding the data of one processor and thread
+   */
+  static std::string
+  restartFileName(const std::string & base_file_name, processor_id_type proc_id, THREAD_ID tid);
+
   /**
    * Serializes the data for the Systems in FEProblemBase
    */
@@ -90,6 +118,9 @@ private:
    */
   void deserializeSystems(std::istream & stream);
 
+  /// Version of the restartable data format
+  static const unsigned int _file_version = 3;
+
   /// Reference to a FEProblemBase being restarted
   FEProblemBase & _fe_problem;
 
@@ -15,8 +15,19 @@
 
 #include "libmesh/mesh_base.h"
 
+// C++ includes
+#include <map>
+
 // Forward declarations
 class MultiAppInterpolationTransfer;
+class KDTree;
+class MooseMesh;
+
+namespace libMesh
+{
+template <typename T>
+class NumericVector;
+}
 
 template <>
 InputParameters validParams<MultiAppInterpolationTransfer>();
@@ -33,7 +44,65 @@ public:
 
   virtual void execute() override;
 
+  /// Number of times the cached inverse distance stencils were reused instead of rebuilt
+  unsigned long numStencilReuses() const { return _num_stencil_reuses; }
+
 protected:
+  /**
+   * The inverse distance weights of the source values for the local target dofs of one target
+   * system, stored in compressed sparse row format. Applying it is a sparse matrix-vector product
+   * with the gathered source values.
+   */
+  struct InterpolationStencil
+  {
+    /// The target dofs
+    std::vector<dof_id_type> dofs;
+
+    /// Start of the entries of each target dof in sources and weights, with one extra at the end
+    std::vector<std::size_t> offsets;
+
+    /// Indices of the nearest source points in the gathered source values
+    std::vector<std::size_t> sources;
+
+    /// Unnormalized inverse distance weights of the sources
+    std::vector<Real> weights;
+  };
+
+  /**
+   * Whether the cached stencils can be reused: no mesh involved in the transfer changed and no
+   * app moved since they were built. This must be called on all processors.
+   */
+  bool stencilsAreCurrent();
+
+  /**
+   * Collects the locations (shifted by offset) and dofs of the local target nodes or elements of
+   * a variable.
+   */
+  void getTargetPoints(const MeshBase & mesh,
+                       unsigned int sys_num,
+                       unsigned int var_num,
+                       bool is_nodal,
+                       const Point & offset,
+                       std::vector<Point> & points,
+                       std::vector<dof_id_type> & dofs) const;
+
+  /**
+   * Builds the stencil of the target points from the _num_points nearest of the n_src gathered
+   * source points in kd_tree.
+   */
+  void buildStencil(InterpolationStencil & stencil,
+                    KDTree & kd_tree,
+                    std::size_t n_src,
+                    const std::vector<Point> & points,
+                    const std::vector<dof_id_type> & dofs) const;
+
+  /**
+   * Interpolates the gathered source values to the dofs of a stencil.
+   */
+  void applyStencil(const InterpolationStencil & stencil,
+                    const std::vector<Number> & src_vals,
+                    NumericVector<Real> & solution) const;
+
   /**
    * Return the nearest node to the point p.
    * @param p The point you want to find the nearest node to.
@@ -54,6 +123,25 @@ protected:
   Real _power;
   MooseEnum _interp_type;
   Real _radius;
+
+  /// Whether the inverse distance stencils are cached and reused while the meshes do not change
+  const bool _cache_stencils;
+
+  /// The cached stencils, indexed by the global app number (always 0 when transferring from the
+  /// MultiApp)
+  std::map<unsigned int, InterpolationStencil> _stencils;
+
+  /// The meshes and their change counts when the stencils were built
+  std::vector<std::pair<const MooseMesh *, unsigned int>> _stencil_mesh_changes;
+
+  /// The positions of the local apps when the stencils were built
+  std::vector<Point> _stencil_app_positions;
+
+  /// Whether the stencils have been built
+  bool _stencils_built;
+
+  /// Number of times the cached stencils were reused
+  unsigned long _num_stencil_reuses;
 };
 
 #endif /* MULTIAPPINTERPOLATIONTRANSFER_H */
@@ -12,6 +12,7 @@
 
 // MOOSE includes
 #include "MultiAppTransfer.h"
+#include "KDTree.h"
 
 // Forward declarations
 class MultiAppNearestNodeTransfer;
@@ -64,6 +65,42 @@ protected:
 
   void getLocalNodes(MooseMesh * mesh, std::vector<Node *> & local_nodes);
 
+  /**
+   * Spatial index over the local source nodes (those with dofs of the source variable) of one
+   * "from" app
+   */
+  struct SourceTree
+  {
+    /// Coordinates of the source nodes, the KDTree refers to these
+    std::vector<Point> points;
+    /// Solution dof of the source variable at each of the points
+    std::vector<dof_id_type> dofs;
+    /// The tree itself (nullptr if there are no source nodes)
+    std::unique_ptr<KDTree> tree;
+    /// The mesh the tree was built for and its change count at the time
+    const MooseMesh * mesh = nullptr;
+    unsigned int mesh_change_count = 0;
+  };
+
+  /**
+   * (Re)builds the trees of the local "from" apps whose meshes changed or are displaced since the
+   * trees were last built
+   */
+  void updateSourceTrees();
+
+  /**
+   * Finds the nearest source node with a dof to the (transfer frame) point p within the local
+   * "from" apps.
+   * @param p The point to search from
+   * @param distance Will hold the distance to the nearest node (max Real if none found)
+   * @param i_local_from Will hold the local index of the "from" app owning the nearest node
+   * @param dof Will hold the solution dof at the nearest node
+   */
+  void findNearestSourceNode(const Point & p,
+                             Real & distance,
+                             unsigned int & i_local_from,
+                             dof_id_type & dof) const;
+
   AuxVariableName _to_var_name;
   VariableName _from_var_name;
 
@@ -82,6 +119,9 @@ protected:
   std::vector<std::vector<dof_id_type>> & _cached_dof_ids;
   std::map<dof_id_type, unsigned int> & _cached_from_inds;
   std::map<dof_id_type, unsigned int> & _cached_qp_inds;
+
+  /// Spatial indices of the local "from" apps, reused while their meshes are unchanged
+  std::vector<std::unique_ptr<SourceTree>> _source_trees;
 };
 
 #endif /* MULTIAPPNEARESTNODETRANSFER_H */
@@ -12,6 +12,8 @@
 
 #include "MultiAppTransfer.h"
 
+#include "libmesh/mesh_function.h"
+
 // Forward declarations
 namespace libMesh
 {
@@ -43,12 +45,21 @@ protected:
 
   void projectSolution(unsigned int to_problem);
 
+  /**
+   * Whether the data cached in the last execution (the quadrature points and their source
+   * processors, the source mesh functions and the projection matrices) can be reused: no mesh
+   * involved in the transfer changed and no app moved since then. This must be called on all
+   * processors.
+   */
+  bool cacheIsCurrent();
+
   AuxVariableName _to_var_name;
   VariableName _from_var_name;
 
   MooseEnum _proj_type;
 
-  /// True, if we need to recompute the projection matrix
+  /// True, if we need to recompute the projection matrix (otherwise the matrices and
+  /// preconditioners of the projection systems are reused and only the right hand sides assembled)
   bool _compute_matrix;
   std::vector<LinearImplicitSystem *> _proj_sys;
   /// Having one projection variable number seems weird, but there is always one variable in every system being used for projection,
@@ -62,6 +73,16 @@ protected:
   bool _qps_cached;
   std::vector<std::vector<Point>> _cached_qps;
   std::vector<std::map<std::pair<unsigned int, unsigned int>, unsigned int>> _cached_index_map;
+
+  /// The mesh functions of the local "from" problems, their point locators are reused as long as
+  /// the meshes do not change
+  std::vector<std::unique_ptr<MeshFunction>> _local_meshfuns;
+
+  /// The meshes and their change counts when the cached data was computed
+  std::vector<std::pair<const MooseMesh *, unsigned int>> _cached_mesh_changes;
+
+  /// The app positions when the cached data was computed
+  std::vector<Point> _cached_positions;
 };
 
 #endif /* MULTIAPPPROJECTIONTRANSFER_H */
@@ -60,12 +60,14 @@ public:
    * data)
    * @param p The location at which to return a value
    * @param var_name The variable to be evaluated
+   * @param tid The thread of the caller (evaluations without it are serialized)
    * @return The desired value for the given variable at a location
    */
   Real pointValueWrapper(Real t,
                          const Point & p,
                          const std::string & var_name,
-                         const MooseEnum & weighting_type = weightingType()) const;
+                         const MooseEnum & weighting_type = weightingType(),
+                         THREAD_ID tid = libMesh::invalid_uint) const;
 
   /**
    * Returns a value at a specific location and variable (see SolutionFunction)
@@ -73,9 +75,13 @@ public:
    * data)
    * @param p The location at which to return a value
    * @param local_var_index The local index of the variable to be evaluated
+   * @param tid The thread of the caller (evaluations without it are serialized)
    * @return The desired value for the given variable at a location
    */
-  Real pointValue(Real t, const Point & p, const unsigned int local_var_index) const;
+  Real pointValue(Real t,
+                  const Point & p,
+                  const unsigned int local_var_index,
+                  THREAD_ID tid = libMesh::invalid_uint) const;
 
   /**
    * Returns a value at a specific location and variable (see SolutionFunction)
@@ -83,9 +89,30 @@ public:
    * data)
    * @param p The location at which to return a value
    * @param var_name The variable to be evaluated
+   * @param tid The thread of the caller (evaluations without it are serialized)
    * @return The desired value for the given variable at a location
    */
-  Real pointValue(Real t, const Point & p, const std::string & var_name) const;
+  Real pointValue(Real t,
+                  const Point & p,
+                  const std::string & var_name,
+                  THREAD_ID tid = libMesh::invalid_uint) const;
+
+  /**
+   * Returns the values of a variable at a list of points (see pointValue()). The points are
+   * located in order, checking the element that contained the previous point first, so lists of
+   * nearby points (e.g. nodes of neighboring elements) are evaluated quickly.
+   * @param t The time at which to extract (not used, it is handled automatically when reading the
+   * data)
+   * @param points The locations at which to return values
+   * @param var_name The variable to be evaluated
+   * @param values Filled with the value at each point
+   * @param tid The thread of the caller (evaluations without it are serialized)
+   */
+  void pointValues(Real t,
+                   const std::vector<Point> & points,
+                   const std::string & var_name,
+                   std::vector<Real> & values,
+                   THREAD_ID tid = libMesh::invalid_uint) const;
 
   /**
    * Returns a value at a specific location and variable for cases where the solution is
@@ -96,10 +123,13 @@ public:
    * data)
    * @param p The location at which to return a value
    * @param local_var_index The local index of the variable to be evaluated
+   * @param tid The thread of the caller (evaluations without it are serialized)
    * @return The desired value for the given variable at a location
    */
-  std::map<const Elem *, Real>
-  discontinuousPointValue(Real t, Point pt, const unsigned int local_var_index) const;
+  std::map<const Elem *, Real> discontinuousPointValue(Real t,
+                                                       Point pt,
+                                                       const unsigned int local_var_index,
+                                                       THREAD_ID tid = libMesh::invalid_uint) const;
 
   /**
    * Returns a value at a specific location and variable for cases where the solution is
@@ -110,10 +140,13 @@ public:
    * data)
    * @param p The location at which to return a value
    * @param var_name The variable to be evaluated
+   * @param tid The thread of the caller (evaluations without it are serialized)
    * @return The desired value for the given variable at a location
    */
-  std::map<const Elem *, Real>
-  discontinuousPointValue(Real t, const Point & p, const std::string & var_name) const;
+  std::map<const Elem *, Real> discontinuousPointValue(Real t,
+                                                       const Point & p,
+                                                       const std::string & var_name,
+                                                       THREAD_ID tid = libMesh::invalid_uint) const;
 
   /**
    * Returns the gradient at a specific location and variable checking for multiple values and
@@ -123,12 +156,14 @@ public:
    * data)
    * @param p The location at which to return a value
    * @param var_name The variable to be evaluated
+   * @param tid The thread of the caller (evaluations without it are serialized)
    * @return The desired value for the given variable at a location
    */
   RealGradient pointValueGradientWrapper(Real t,
                                          const Point & p,
                                          const std::string & var_name,
-                                         const MooseEnum & weighting_type = weightingType()) const;
+                                         const MooseEnum & weighting_type = weightingType(),
+                                         THREAD_ID tid = libMesh::invalid_uint) const;
 
   /**
    * Returns the gradient at a specific location and variable (see SolutionFunction)
@@ -136,9 +171,13 @@ public:
    * data)
    * @param p The location at which to return a value
    * @param var_name The variable to be evaluated
+   * @param tid The thread of the caller (evaluations without it are serialized)
    * @return The desired value for the given variable at a location
    */
-  RealGradient pointValueGradient(Real t, const Point & p, const std::string & var_name) const;
+  RealGradient pointValueGradient(Real t,
+                                  const Point & p,
+                                  const std::string & var_name,
+                                  THREAD_ID tid = libMesh::invalid_uint) const;
 
   /**
    * Returns the gradient at a specific location and variable (see SolutionFunction)
@@ -146,9 +185,13 @@ public:
    * data)
    * @param p The location at which to return a value
    * @param local_var_index The local index of the variable to be evaluated
+   * @param tid The thread of the caller (evaluations without it are serialized)
    * @return The desired value for the given variable at a location
    */
-  RealGradient pointValueGradient(Real t, Point pt, const unsigned int local_var_index) const;
+  RealGradient pointValueGradient(Real t,
+                                  Point pt,
+                                  const unsigned int local_var_index,
+                                  THREAD_ID tid = libMesh::invalid_uint) const;
 
   /**
    * Returns the gradient at a specific location and variable for cases where the gradient is
@@ -159,10 +202,14 @@ public:
    * data)
    * @param p The location at which to return a value
    * @param var_name The variable to be evaluated
+   * @param tid The thread of the caller (evaluations without it are serialized)
    * @return The desired value for the given variable at a location
    */
   std::map<const Elem *, RealGradient>
-  discontinuousPointValueGradient(Real t, const Point & p, const std::string & var_name) const;
+  discontinuousPointValueGradient(Real t,
+                                  const Point & p,
+                                  const std::string & var_name,
+                                  THREAD_ID tid = libMesh::invalid_uint) const;
 
   /**
    * Returns the gradient at a specific location and variable for cases where the gradient is
@@ -173,10 +220,14 @@ public:
    * data)
    * @param p The location at which to return a value
    * @param local_var_index The local index of the variable to be evaluated
+   * @param tid The thread of the caller (evaluations without it are serialized)
    * @return The desired value for the given variable at a location
    */
   std::map<const Elem *, RealGradient>
-  discontinuousPointValueGradient(Real t, Point pt, const unsigned int local_var_index) const;
+  discontinuousPointValueGradient(Real t,
+                                  Point pt,
+                                  const unsigned int local_var_index,
+                                  THREAD_ID tid = libMesh::invalid_uint) const;
 
   /**
    * Return a value directly from a Node
@@ -236,6 +287,37 @@ protected:
    */
   void readExodusII();
 
+  /**
+   * Copies the variables of a time step of the ExodusII file into a system and localizes them
+   * @param system The system to copy the solution into
+   * @param serialized_solution The vector to localize the solution of the system into
+   * @param index The index of the time step in the file (starting at 0)
+   */
+  void readExodusTimeStep(System & system, NumericVector<Number> & serialized_solution, int index);
+
+  /**
+   * Fills _local_dofs with the dofs of the elements in the file that cover the bounding box of
+   * this processor's part of the simulation mesh
+   */
+  void findLocalDofs();
+
+  /**
+   * Builds the vector that holds the copy of the solution of a system on this processor
+   * (all of it or only the values for _local_dofs)
+   */
+  std::unique_ptr<NumericVector<Number>> buildSerializedSolution(const System & system) const;
+
+  /**
+   * Copies the solution of a system into the vector built with buildSerializedSolution()
+   */
+  void localizeSolution(const System & system, NumericVector<Number> & serialized_solution) const;
+
+  /**
+   * Applies the transformations (see transformation_order) to a point of the simulation
+   * @return The corresponding point of the mesh in the file
+   */
+  Point transformPoint(Point pt) const;
+
   /**
    * Method for extracting value of solution based on the DOF,
    * this is called by the public overloaded function that accept
@@ -263,15 +345,24 @@ protected:
    */
   bool updateExodusBracketingTimeIndices(Real time);
 
+  /**
+   * The MeshFunction to evaluate
+   * @param func_num The MeshFunction index to use (1 = _mesh_function; 2 = _mesh_function2)
+   * @param tid The thread of the caller, the shared MeshFunction is returned for invalid_uint
+   */
+  MeshFunction & meshFunction(unsigned int func_num, THREAD_ID tid) const;
+
   /**
    * A wrapper method for calling the various MeshFunctions used for reading the data
    * @param p The location at which data is desired
    * @param local_var_index The local index of the variable to extract data from
    * @param func_num The MeshFunction index to use (1 = _mesh_function; 2 = _mesh_function2)
+   * @param tid The thread of the caller (evaluations without it are serialized)
    */
   Real evalMeshFunction(const Point & p,
                         const unsigned int local_var_index,
-                        unsigned int func_num) const;
+                        unsigned int func_num,
+                        THREAD_ID tid = libMesh::invalid_uint) const;
 
   /**
    * A wrapper method for calling the various MeshFunctions that calls the mesh function
@@ -279,20 +370,25 @@ protected:
    * @param p The location at which data is desired
    * @param local_var_index The local index of the variable to extract data from
    * @param func_num The MeshFunction index to use (1 = _mesh_function; 2 = _mesh_function2)
+   * @param tid The thread of the caller (evaluations without it are serialized)
    */
-  std::map<const Elem *, Real> evalMultiValuedMeshFunction(const Point & p,
-                                                           const unsigned int local_var_index,
-                                                           unsigned int func_num) const;
+  std::map<const Elem *, Real>
+  evalMultiValuedMeshFunction(const Point & p,
+                              const unsigned int local_var_index,
+                              unsigned int func_num,
+                              THREAD_ID tid = libMesh::invalid_uint) const;
 
   /**
    * A wrapper method interfacing with the libMesh mesh function for evaluating the gradient
    * @param p The location at which data is desired
    * @param local_var_index The local index of the variable to extract data from
    * @param func_num The MeshFunction index to use (1 = _mesh_function; 2 = _mesh_function2)
+   * @param tid The thread of the caller (evaluations without it are serialized)
    */
   RealGradient evalMeshFunctionGradient(const Point & p,
                                         const unsigned int local_var_index,
-                                        unsigned int func_num) const;
+                                        unsigned int func_num,
+                                        THREAD_ID tid = libMesh::invalid_uint) const;
 
   /**
    * A wrapper method interfacing with the libMesh mesh function that calls the gradient
@@ -301,9 +397,13 @@ protected:
    * @param p The location at which data is desired
    * @param local_var_index The local index of the variable to extract data from
    * @param func_num The MeshFunction index to use (1 = _mesh_function; 2 = _mesh_function2)
+   * @param tid The thread of the caller (evaluations without it are serialized)
    */
-  std::map<const Elem *, RealGradient> evalMultiValuedMeshFunctionGradient(
-      const Point & p, const unsigned int local_var_index, unsigned int func_num) const;
+  std::map<const Elem *, RealGradient>
+  evalMultiValuedMeshFunctionGradient(const Point & p,
+                                      const unsigned int local_var_index,
+                                      unsigned int func_num,
+                                      THREAD_ID tid = libMesh::invalid_uint) const;
 
   /// File type to read (0 = xda; 1 = ExodusII)
   MooseEnum _file_type;
@@ -359,6 +459,10 @@ protected:
   /// Pointer to second libMesh::MeshFuntion, used for interpolation
   std::unique_ptr<MeshFunction> _mesh_function2;
 
+  /// Copies of _mesh_function and _mesh_function2 for each thread with their own point locators
+  std::vector<std::unique_ptr<MeshFunction>> _threaded_mesh_function;
+  std::vector<std::unique_ptr<MeshFunction>> _threaded_mesh_function2;
+
   /// Pointer to second serial solution, used for interpolation
   std::unique_ptr<NumericVector<Number>> _serialized_solution2;
 
@@ -407,6 +511,12 @@ protected:
   /// transformations (rotations, translation, scales) are performed in this order
   MultiMooseEnum _transformation_order;
 
+  /// Whether only the part of the solution covering this processor's part of the mesh is kept
+  const bool _restrict_to_local_bounding_box;
+
+  /// Dofs of the solution kept on this processor when restricting to the local bounding box
+  std::vector<dof_id_type> _local_dofs;
+
   /// True if initial_setup has executed
   bool _initialized;
 
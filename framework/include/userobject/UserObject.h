@@ -16,6 +16,7 @@
 #include "MeshChangedInterface.h"
 #include "MooseObject.h"
 #include "MooseTypes.h"
+#include "ReductionBatch.h"
 #include "Restartable.h"
 #include "ScalarCoupleable.h"
 #include "SetupInterface.h"
@@ -113,21 +114,53 @@ public:
   template <typename T>
   void gatherSum(T & value)
   {
-    _communicator.sum(value);
+    if (!_reduction_batch.alreadyReduced(&value))
+      _communicator.sum(value);
   }
 
   template <typename T>
   void gatherMax(T & value)
   {
-    _communicator.max(value);
+    if (!_reduction_batch.alreadyReduced(&value))
+      _communicator.max(value);
   }
 
   template <typename T>
   void gatherMin(T & value)
   {
-    _communicator.min(value);
+    if (!_reduction_batch.alreadyReduced(&value))
+      _communicator.min(value);
   }
 
+  ///@{
+  /**
+   * Deferred versions of gatherSum, gatherMax and gatherMin to be called from finalize().
+   *
+   * While the problem finalizes a group of user objects the values are not reduced right away:
+   * they are all reduced together, with one allreduce per operation, once every object of the
+   * group is finalized. The value therefore only holds the gathered value in getValue(). Calling
+   * gatherSum, gatherMax or gatherMin on the same value during that pass does not reduce it again.
+   * Outside of such a pass the value is reduced immediately.
+   */
+  template <typename T>
+  void deferredGatherSum(T & value)
+  {
+    _reduction_batch.sum(value);
+  }
+
+  template <typename T>
+  void deferredGatherMax(T & value)
+  {
+    _reduction_batch.max(value);
+  }
+
+  template <typename T>
+  void deferredGatherMin(T & value)
+  {
+    _reduction_batch.min(value);
+  }
+  ///@}
+
   template <typename T1, typename T2>
   void gatherProxyValueMax(T1 & value, T2 & proxy)
   {
@@ -143,6 +176,9 @@ protected:
   /// Reference to the FEProblemBase for this user object
   FEProblemBase & _fe_problem;
 
+  /// Collects the deferred reductions of all the user objects finalized together
+  ReductionBatch & _reduction_batch;
+
   /// Thread ID of this postprocessor
   THREAD_ID _tid;
   Assembly & _assembly;
@@ -0,0 +1,82 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef ANDERSONACCELERATION_H
+#define ANDERSONACCELERATION_H
+
+// MOOSE includes
+#include "Moose.h" // using namespace libMesh
+
+#include "libmesh/parallel.h"
+#include "libmesh/parallel_object.h"
+
+// C++ includes
+#include <deque>
+#include <vector>
+
+/**
+ * Accelerates a fixed point iteration x = G(x), such as the Picard iteration between MultiApps,
+ * with Anderson mixing.
+ *
+ * Given the input x_k of the latest iteration and its result g_k = G(x_k), the next input is
+ *
+ *   x_{k+1} = g_k - dG gamma - (1 - beta) (f_k - dF gamma),
+ *
+ * where f = g - x, the columns of dF and dG are the differences of f and g between consecutive
+ * iterations of the history, gamma minimizes |f_k - dF gamma| and beta is the relaxation factor.
+ * Without history this is the relaxed iteration x_{k+1} = (1 - beta) x_k + beta g_k.
+ *
+ * The values may be distributed, in which case every processor passes its local part and the
+ * inner products are summed over all processors, or replicated on all processors.
+ */
+class AndersonAcceleration : public libMesh::ParallelObject
+{
+public:
+  /**
+   * @param depth The number of previous iterations kept in the history
+   * @param relaxation_factor The fraction beta of the new result
+   * @param distributed Whether every processor holds a different part of the values
+   */
+  AndersonAcceleration(const Parallel::Communicator & comm,
+                       unsigned int depth,
+                       Real relaxation_factor,
+                       bool distributed);
+
+  /// Forgets the history, which has to be done when a new fixed point iteration starts
+  void reset();
+
+  /**
+   * Computes the next input of the iteration.
+   * @param x The input of the latest iteration
+   * @param g The result of the latest iteration on input, the next input on output
+   */
+  void step(const std::vector<Real> & x, std::vector<Real> & g);
+
+  /// The number of previous iterations used by the last step
+  unsigned int historySize() const { return _history_size; }
+
+protected:
+  /// The number of previous iterations kept
+  const unsigned int _depth;
+
+  /// The fraction of the new result
+  const Real _relaxation_factor;
+
+  /// Whether inner products need to be summed over the processors
+  const bool _distributed;
+
+  /// The inputs and results of the latest iterations, oldest first
+  std::deque<std::vector<Real>> _x_history;
+  std::deque<std::vector<Real>> _g_history;
+
+  /// The number of previous iterations used by the last step
+  unsigned int _history_size;
+};
+
+#endif // ANDERSONACCELERATION_H
@@ -0,0 +1,281 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef COMPRESSEDROWTABLE_H
+#define COMPRESSEDROWTABLE_H
+
+// MOOSE includes
+#include "Moose.h" // using namespace libMesh
+
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/**
+ * Maps ids (i.e. node ids) to sorted lists of unique values (i.e. the ids of the connected
+ * elements) stored in compressed sparse row format: all the values are kept in one contiguous
+ * vector and each row is a slice of it. Compared to a std::map of containers this needs a
+ * fraction of the memory and a lookup is an index operation instead of a tree search.
+ *
+ * The rows are indexed directly by the id as long as most ids below the largest one have a row.
+ * Otherwise (i.e. the semilocal part of a distributed mesh or the large ids of quadrature nodes)
+ * only the ids that have a row are stored and looked up with a binary search.
+ *
+ * The table is immutable once built, so any number of threads may read it concurrently.
+ */
+template <typename T>
+class CompressedRowTable
+{
+public:
+  /**
+   * Read only view of the values of one row
+   */
+  class Row
+  {
+  public:
+    Row() : _begin(nullptr), _end(nullptr) {}
+    Row(const T * begin, const T * end) : _begin(begin), _end(end) {}
+
+    const T * begin() const { return _begin; }
+    const T * end() const { return _end; }
+    std::size_t size() const { return _end - _begin; }
+    bool empty() const { return _begin == _end; }
+    const T & operator[](std::size_t i) const { return _begin[i]; }
+
+    /// Whether the row contains the value, the values of a row are sorted so this is a bisection
+    bool contains(const T & value) const { return std::binary_search(_begin, _end, value); }
+
+  private:
+    const T * _begin;
+    const T * _end;
+  };
+
+  CompressedRowTable() : _sparse(false) {}
+
+  /**
+   * Builds the table from scratch using threads.
+   *
+   * @param n_dense_ids Ids below this (i.e. max_node_id()) are counted in a temporary array,
+   *                    larger ones are collected separately and should be rare
+   * @param sources The objects (i.e. elements) that produce the entries
+   * @param visitor Called as visitor(source, entries) for each of the sources, where it appends
+   *                the (id, value) pairs of that source to the std::vector entries. Duplicate
+   *                pairs are fine, they are removed.
+   */
+  template <typename Source, typename Visitor>
+  void build(dof_id_type n_dense_ids, const std::vector<Source> & sources, const Visitor & visitor);
+
+  /// Returns the values of id, this is empty if there are none
+  Row operator[](dof_id_type id) const;
+
+  /// Whether there are values for id
+  bool hasRow(dof_id_type id) const { return !(*this)[id].empty(); }
+
+  /// Number of ids with values
+  std::size_t nRows() const;
+
+  /// Total number of values in all the rows
+  std::size_t nEntries() const { return _values.size(); }
+
+  /// Bytes of memory used by the table
+  std::size_t memoryUsage() const;
+
+  /// Removes all rows
+  void clear();
+
+protected:
+  /// Whether _ids holds the ids of the rows or the rows are indexed by the ids
+  bool _sparse;
+
+  /// Sorted ids of the rows if _sparse
+  std::vector<dof_id_type> _ids;
+
+  /// Start of each row in _values, the last entry is the total number of values
+  std::vector<dof_id_type> _offsets;
+
+  /// All the values, row by row
+  std::vector<T> _values;
+};
+
+template <typename T>
+template <typename Source, typename Visitor>
+void
+CompressedRowTable<T>::build(dof_id_type n_dense_ids,
+                             const std::vector<Source> & sources,
+                             const Visitor & visitor)
+{
+  typedef std::vector<std::pair<dof_id_type, T>> Entries;
+
+  clear();
+
+  const Threads::BlockedRange<std::size_t> source_range(0, sources.size());
+
+  // Count the values of each dense id (the counts are value initialized to zero)
+  std::unique_ptr<std::atomic<dof_id_type>[]> cursors(new std::atomic<dof_id_type>[n_dense_ids]());
+  Entries large_id_entries;
+  Threads::spin_mutex large_id_mutex;
+  Threads::parallel_for(source_range, [&](const Threads::BlockedRange<std::size_t> & range) {
+    Entries entries;
+    Entries large_entries;
+    for (std::size_t i = range.begin(); i < range.end(); ++i)
+    {
+      entries.clear();
+      visitor(sources[i], entries);
+      for (const auto & entry : entries)
+        if (entry.first < n_dense_ids)
+          cursors[entry.first].fetch_add(1, std::memory_order_relaxed);
+        else
+          large_entries.push_back(entry);
+    }
+
+    if (!large_entries.empty())
+    {
+      Threads::spin_mutex::scoped_lock lock(large_id_mutex);
+      large_id_entries.insert(large_id_entries.end(), large_entries.begin(), large_entries.end());
+    }
+  });
+  std::sort(large_id_entries.begin(), large_id_entries.end());
+
+  // Lay out the rows, only keeping the ids that have values if they are few
+  dof_id_type n_dense_rows = 0;
+  for (dof_id_type id = 0; id < n_dense_ids; ++id)
+    if (cursors[id].load(std::memory_order_relaxed))
+      n_dense_rows++;
+  _sparse = !large_id_entries.empty() || n_dense_rows < n_dense_ids / 4;
+
+  dof_id_type n_values = 0;
+  for (dof_id_type id = 0; id < n_dense_ids; ++id)
+  {
+    const dof_id_type count = cursors[id].load(std::memory_order_relaxed);
+    if (_sparse && count == 0)
+      continue;
+
+    if (_sparse)
+      _ids.push_back(id);
+    _offsets.push_back(n_values);
+    cursors[id].store(n_values, std::memory_order_relaxed);
+    n_values += count;
+  }
+
+  const dof_id_type n_dense_values = n_values;
+  for (const auto & entry : large_id_entries)
+  {
+    if (_ids.empty() || _ids.back() != entry.first)
+    {
+      _ids.push_back(entry.first);
+      _offsets.push_back(n_values);
+    }
+    n_values++;
+  }
+  _offsets.push_back(n_values);
+
+  // Fill in the values
+  _values.resize(n_values);
+  Threads::parallel_for(source_range, [&](const Threads::BlockedRange<std::size_t> & range) {
+    Entries entries;
+    for (std::size_t i = range.begin(); i < range.end(); ++i)
+    {
+      entries.clear();
+      visitor(sources[i], entries);
+      for (const auto & entry : entries)
+        if (entry.first < n_dense_ids)
+          _values[cursors[entry.first].fetch_add(1, std::memory_order_relaxed)] = entry.second;
+    }
+  });
+  for (std::size_t i = 0; i < large_id_entries.size(); ++i)
+    _values[n_dense_values + i] = large_id_entries[i].second;
+  cursors.reset();
+
+  // Sort the rows and remove duplicate values
+  const std::size_t n_rows = _offsets.size() - 1;
+  std::vector<dof_id_type> row_sizes(n_rows);
+  Threads::parallel_for(Threads::BlockedRange<std::size_t>(0, n_rows),
+                        [&](const Threads::BlockedRange<std::size_t> & range) {
+                          for (std::size_t row = range.begin(); row < range.end(); ++row)
+                          {
+                            auto begin = _values.begin() + _offsets[row];
+                            auto end = _values.begin() + _offsets[row + 1];
+                            std::sort(begin, end);
+                            row_sizes[row] = std::unique(begin, end) - begin;
+                          }
+                        });
+
+  // Close the gaps left by the duplicates
+  n_values = 0;
+  for (std::size_t row = 0; row < n_rows; ++row)
+  {
+    auto begin = _values.begin() + _offsets[row];
+    _offsets[row] = n_values;
+    std::copy(begin, begin + row_sizes[row], _values.begin() + n_values);
+    n_values += row_sizes[row];
+  }
+  _offsets[n_rows] = n_values;
+  _values.resize(n_values);
+  _values.shrink_to_fit();
+}
+
+template <typename T>
+typename CompressedRowTable<T>::Row CompressedRowTable<T>::operator[](dof_id_type id) const
+{
+  std::size_t row;
+  if (_sparse)
+  {
+    auto it = std::lower_bound(_ids.begin(), _ids.end(), id);
+    if (it == _ids.end() || *it != id)
+      return Row();
+    row = it - _ids.begin();
+  }
+  else
+  {
+    if (_offsets.empty() || id >= _offsets.size() - 1)
+      return Row();
+    row = id;
+  }
+
+  return Row(_values.data() + _offsets[row], _values.data() + _offsets[row + 1]);
+}
+
+template <typename T>
+std::size_t
+CompressedRowTable<T>::nRows() const
+{
+  if (_sparse)
+    return _ids.size();
+
+  std::size_t n_rows = 0;
+  for (std::size_t row = 0; row + 1 < _offsets.size(); ++row)
+    if (_offsets[row + 1] > _offsets[row])
+      n_rows++;
+  return n_rows;
+}
+
+template <typename T>
+std::size_t
+CompressedRowTable<T>::memoryUsage() const
+{
+  return sizeof(*this) + (_ids.capacity() + _offsets.capacity()) * sizeof(dof_id_type) +
+         _values.capacity() * sizeof(T);
+}
+
+template <typename T>
+void
+CompressedRowTable<T>::clear()
+{
+  _sparse = false;
+  _ids.clear();
+  _offsets.clear();
+  _values.clear();
+}
+
+#endif // COMPRESSEDROWTABLE_H
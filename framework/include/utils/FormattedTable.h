@@ -32,6 +32,11 @@ void dataLoad(std::istream & stream, FormattedTable & v, void * context);
 
 /**
  * This class is used for building, formatting, and outputting tables of numbers.
+ *
+ * The data is stored by column: each column name is interned to an index into a list of
+ * contiguous value arrays that share the row numbering of the independent variable (normally
+ * time). Optionally only a trailing window of rows is kept in memory; older rows are discarded
+ * once they have been written to the CSV file.
  */
 class FormattedTable
 {
@@ -89,7 +94,22 @@ public:
    */
   void outputTimeColumn(bool output_time) { _output_time = output_time; }
 
-  //  const std::map<Real, std::map<std::string, Real>> & getData() const { return _data; }
+  /**
+   * Only keep (at least) the last max_rows rows in memory, a value of zero keeps all of them.
+   * Rows are discarded in chunks, so up to twice as many rows may be held. If the table is
+   * written with printCSV, rows are not discarded before they have been written.
+   */
+  void setMaxRows(std::size_t max_rows) { _max_rows = max_rows; }
+
+  /**
+   * The number of rows held in memory
+   */
+  std::size_t numRows() const { return _times.size(); }
+
+  /**
+   * The number of rows added to the table, including the ones that were discarded
+   */
+  std::size_t numTotalRows() const { return _first_row + _times.size(); }
 
   /**
    * Methods for dumping the table to the stream - either by filename or by stream handle.  If
@@ -161,13 +181,36 @@ protected:
    */
   unsigned short getTermWidth(bool use_environment) const;
 
-  /**
-   * Data structure for the console table:
-   * The first part of the pair tracks the independent variable (normally time) and is associated
-   * with the second part of the table which is the map of dependent variables and their associated
-   * values.
-   */
-  std::vector<std::pair<Real, std::map<std::string, Real>>> _data;
+  /// Returns the index of the column with the given name, adding the column if necessary
+  unsigned int columnIndex(const std::string & name);
+
+  /// Returns the indices of the columns in the order of _column_names
+  std::vector<unsigned int> columnOrder() const;
+
+  /// Returns the value of a column in a row held in memory, missing values are zero
+  Real value(unsigned int column, std::size_t row) const
+  {
+    const auto & values = _columns[column];
+    return row < values.size() ? values[row] : 0.;
+  }
+
+  /// Discards the oldest rows if more than twice the allowed number of rows are held
+  void trimRows();
+
+  /// The independent variable (normally time) of the rows held in memory
+  std::vector<Real> _times;
+
+  /// The values of each column for the rows held in memory; columns may be shorter than _times
+  std::vector<std::vector<Real>> _columns;
+
+  /// The index into _columns of each column name
+  std::map<std::string, unsigned int> _column_index;
+
+  /// The number of rows that were discarded from the front of the table
+  std::size_t _first_row;
+
+  /// The number of rows to keep in memory, zero keeps all rows
+  std::size_t _max_rows;
 
   /// Alignment widths (only used if asked to print aligned to CSV output)
   std::map<std::string, unsigned int> _align_widths;
@@ -188,7 +231,7 @@ private:
   /// Open or switch the underlying file stream to point to file_name. This is idempotent.
   void open(const std::string & file_name);
 
-  void printRow(std::pair<Real, std::map<std::string, Real>> & row_data, bool align);
+  void printRow(std::size_t row, const std::vector<unsigned int> & columns, bool align);
 
   /// The optional output file stream
   std::string _output_file_name;
@@ -197,11 +240,14 @@ private:
   std::ofstream _output_file;
 
   /**
-   * Keeps track of the index indicating which vector elements have been output. All items
-   * with an index less than this index have been output. Higher values have not.
+   * Keeps track of the index indicating which rows have been output. All rows with an index
+   * (counting discarded rows) less than this index have been output. Higher values have not.
    */
   std::size_t _output_row_index;
 
+  /// Whether the table is written with printCSV, in which case unwritten rows are kept
+  bool _csv_output;
+
   /// Keeps track of whether the current stream is open or not.
   bool _stream_open;
 
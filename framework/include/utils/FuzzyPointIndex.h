@@ -0,0 +1,87 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef FUZZYPOINTINDEX_H
+#define FUZZYPOINTINDEX_H
+
+// MOOSE includes
+#include "Moose.h" // using namespace libMesh
+
+#include "libmesh/point.h"
+
+// C++ includes
+#include <array>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Spatial hash of points that answers "which stored point is relative_fuzzy_equals() to this
+ * one?" without comparing against every stored point. The answer is exactly the one of a linear
+ * search: the first inserted point that matches.
+ *
+ * The points are binned into a uniform grid whose cell size follows the average point spacing
+ * and is readjusted as points are added. This is what MooseMesh::addUniqueNode() uses, and it may
+ * be used by anything else that merges coincident points (i.e. nodes).
+ */
+class FuzzyPointIndex
+{
+public:
+  FuzzyPointIndex();
+
+  /// Returned by find() if there is no matching point
+  static const std::size_t invalid_index;
+
+  /**
+   * Stores a point, its index is the number of points stored before it
+   */
+  void insert(const Point & p);
+
+  /**
+   * Returns the index of the first stored point q for which p.relative_fuzzy_equals(q, tol), or
+   * invalid_index if there is none.
+   */
+  std::size_t find(const Point & p, Real tol) const;
+
+  /// Number of stored points
+  std::size_t size() const { return _points.size(); }
+
+  /// Removes all points
+  void clear();
+
+protected:
+  typedef std::array<long long, LIBMESH_DIM> Cell;
+
+  struct CellHash
+  {
+    std::size_t operator()(const Cell & cell) const;
+  };
+
+  /// Returns the grid cell containing p
+  Cell cell(const Point & p) const;
+
+  /// Chooses a new cell size from the bounding box of the stored points and re-bins them
+  void rebin();
+
+  /// Same as find(), but checks every stored point
+  std::size_t linearFind(const Point & p, Real tol) const;
+
+  /// The stored points
+  std::vector<Point> _points;
+
+  /// Indices of the points in each (non-empty) cell
+  std::unordered_map<Cell, std::vector<std::size_t>, CellHash> _cells;
+
+  /// Edge length of the cells
+  Real _cell_size;
+
+  /// Number of points when the cell size was last chosen
+  std::size_t _binned_size;
+};
+
+#endif // FUZZYPOINTINDEX_H
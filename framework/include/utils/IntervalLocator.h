@@ -0,0 +1,92 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef INTERVALLOCATOR_H
+#define INTERVALLOCATOR_H
+
+#include "Moose.h"
+
+// C++ includes
+#include <algorithm>
+#include <vector>
+
+/**
+ * Finds the interval of a strictly increasing table that contains a given value without
+ * allocating memory.
+ *
+ * The interval found last is tried first, followed by the one after it, since successive lookups
+ * (e.g. at the quadrature points of an element or in consecutive time steps) tend to be close to
+ * each other. On uniformly spaced tables the interval is computed directly from the spacing;
+ * otherwise a binary search is done.
+ *
+ * The interval found last is cached in the object, so an IntervalLocator must not be used by
+ * several threads at once.
+ */
+class IntervalLocator
+{
+public:
+  IntervalLocator() : _uniform(false), _x0(0.0), _inverse_dx(0.0), _last_interval(0) {}
+
+  /**
+   * Prepares the lookup for the strictly increasing table x, which has to be called again
+   * whenever x changes
+   */
+  void init(const std::vector<Real> & x);
+
+  /**
+   * Returns the index i of the interval of x satisfying x[i] <= value < x[i + 1]. x needs at
+   * least two entries and must satisfy x[0] <= value < x.back().
+   */
+  std::size_t find(const std::vector<Real> & x, Real value) const;
+
+  /// Whether the table passed to init() is uniformly spaced
+  bool uniform() const { return _uniform; }
+
+private:
+  /// Whether the interval can be computed from the spacing of the table
+  bool _uniform;
+
+  /// The first entry of the table
+  Real _x0;
+
+  /// The inverse of the spacing of a uniform table
+  Real _inverse_dx;
+
+  /// The interval found by the last lookup
+  mutable std::size_t _last_interval;
+};
+
+inline std::size_t
+IntervalLocator::find(const std::vector<Real> & x, Real value) const
+{
+  const std::size_t last = x.size() - 2;
+
+  std::size_t i = std::min(_last_interval, last);
+  if (value >= x[i] && value < x[i + 1])
+    return i;
+
+  if (_uniform)
+  {
+    // the guess may be off by an interval due to round off, which the loops below correct
+    i = std::min(static_cast<std::size_t>((value - _x0) * _inverse_dx), last);
+    while (value < x[i])
+      --i;
+    while (value >= x[i + 1])
+      ++i;
+  }
+  else if (i < last && value >= x[i + 1] && value < x[i + 2])
+    ++i;
+  else
+    i = std::upper_bound(x.begin(), x.end(), value) - x.begin() - 1;
+
+  _last_interval = i;
+  return i;
+}
+
+#endif // INTERVALLOCATOR_H
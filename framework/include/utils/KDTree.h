@@ -32,6 +32,21 @@ public:
                       std::vector<std::size_t> & return_index,
                       std::vector<Real> & return_dist_sqr);
 
+  /**
+   * Finds the patch_size nearest points when the points moved by at most max_displacement since
+   * the tree was built, without rebuilding it: all points that were close enough before they
+   * moved are checked at their current location.
+   *
+   * @param current_points The current locations of the points the tree was built from
+   * @param max_displacement Upper bound of the distance each point moved
+   * @return The number of points that had to be checked
+   */
+  std::size_t neighborSearch(Point & query_point,
+                             unsigned int patch_size,
+                             const std::vector<Point> & current_points,
+                             Real max_displacement,
+                             std::vector<std::size_t> & return_index);
+
   /**
    * PointListAdaptor is required to use libMesh Point coordinate type with
    * nanoflann KDTree library. The member functions within the PointListAdaptor
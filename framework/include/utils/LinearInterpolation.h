@@ -14,9 +14,14 @@
 #include <string>
 
 #include "Moose.h"
+#include "IntervalLocator.h"
 
 /**
  * This class interpolates values given a set of data pairs and an abscissa.
+ *
+ * The interval containing the abscissa is found with an IntervalLocator, which caches the
+ * interval found last; a LinearInterpolation must therefore not be sampled by several threads at
+ * once.
  */
 class LinearInterpolation
 {
@@ -48,6 +53,12 @@ public:
    */
   Real sample(Real x) const;
 
+  /**
+   * Samples the fit at all the abscissas in x, which gives the same values as calling sample() for
+   * each of them. values is resized to the size of x.
+   */
+  void sample(const std::vector<Real> & x, std::vector<Real> & values) const;
+
   /**
    * This function will take an independent variable input and will return the derivative of the
    * dependent variable
@@ -55,6 +66,12 @@ public:
    */
   Real sampleDerivative(Real x) const;
 
+  /**
+   * Computes both the value and the derivative of the fit at x with a single lookup, giving the
+   * same results as sample() and sampleDerivative()
+   */
+  void sampleValueAndDerivative(Real x, Real & value, Real & derivative) const;
+
   /**
    * This function will dump GNUPLOT input files that can be run to show the data points and
    * function fits
@@ -85,6 +102,9 @@ private:
   std::vector<Real> _x;
   std::vector<Real> _y;
 
+  /// Finds the interval of _x containing an abscissa
+  IntervalLocator _locator;
+
   static int _file_number;
 };
 
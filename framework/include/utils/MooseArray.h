@@ -148,6 +148,19 @@ public:
    */
   void shallowCopy(std::vector<T> & rhs);
 
+  /**
+   * Doesn't actually make a copy of the data.
+   *
+   * Just makes _this_ object operate on size entries of the data in rhs, starting at
+   * offset.  The data stays owned by rhs: never call release() or resize() beyond size
+   * on _this_ array while it refers to rhs.
+   *
+   * @param rhs The array holding the data
+   * @param offset The index of the first entry of rhs to operate on
+   * @param size The number of entries to operate on
+   */
+  void shallowCopy(const MooseArray & rhs, const unsigned int offset, const unsigned int size);
+
   /**
    * Actual operator=... really does make a copy of the data
    *
@@ -283,6 +296,22 @@ MooseArray<T>::shallowCopy(const MooseArray & rhs)
   _allocated_size = rhs._allocated_size;
 }
 
+template <typename T>
+inline void
+MooseArray<T>::shallowCopy(const MooseArray & rhs,
+                           const unsigned int offset,
+                           const unsigned int size)
+{
+  mooseAssert(offset + size <= rhs._size,
+              "Shallow copy out of bounds in MooseArray (offset: " << offset << " size: " << size
+                                                                   << " rhs size: " << rhs._size
+                                                                   << ")");
+
+  _data = rhs._data + offset;
+  _size = size;
+  _allocated_size = size;
+}
+
 template <typename T>
 inline void
 MooseArray<T>::shallowCopy(std::vector<T> & rhs)
@@ -279,9 +279,8 @@ bool relativeFuzzyLessThan(const libMesh::Real & var1,
                            const libMesh::Real & tol = libMesh::TOLERANCE * libMesh::TOLERANCE);
 
 /**
- * Function to dump the contents of MaterialPropertyStorage for debugging purposes
- * @param props The storage item to dump, this should be
- * MaterialPropertyStorage.props()/propsOld()/propsOlder().
+ * Function to dump the contents of per-element material properties for debugging purposes
+ * @param props The properties to dump, indexed by element and side
  *
  * Currently this only words for scalar material properties. Something to do as needed would be to
  * create a method in MaterialProperty
@@ -336,7 +335,8 @@ std::list<std::string> getFilesInDirs(const std::list<std::string> & directory_l
 
 /**
  * Returns the most recent checkpoint or mesh file given a list of files.
- * If a suitable file isn't found the empty string is returned
+ * If a suitable file isn't found the empty string is returned. Checkpoints whose restartable data
+ * was not completely written by all the processors are skipped.
  * @param checkpoint_files the list of files to analyze
  */
 std::string getLatestMeshCheckpointFile(const std::list<std::string> & checkpoint_files);
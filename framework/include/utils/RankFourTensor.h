@@ -233,6 +233,12 @@ public:
   /// checks if the tensor is symmetric
   bool isSymmetric() const;
 
+  /**
+   * checks if the tensor has the minor symmetries C_ijkl = C_jikl = C_ijlk, allowing differences
+   * of up to tolerance * L2norm() to account for round-off from earlier operations
+   */
+  bool isMinorSymmetric(Real tolerance = 0.0) const;
+
   /// checks if the tensor is isotropic
   bool isIsotropic() const;
 
@@ -432,6 +432,15 @@ private:
   static constexpr unsigned int N = LIBMESH_DIM;
   static constexpr unsigned int N2 = N * N;
 
+  /**
+   * Computes the eigenvalues, in ascending order, and the eigenvectors of the symmetric part of
+   * this tensor using cyclic Jacobi rotations. Unlike syev this needs no memory allocation, and it
+   * finds (nearly) equal eigenvalues and their eigenvectors to full accuracy.
+   * @param eigvals The eigenvalues
+   * @param eigvecs The eigenvectors, eigvecs[j][i] is component j of eigenvector i
+   */
+  void symmetricEigenJacobi(Real eigvals[N], Real eigvecs[N][N]) const;
+
   /// The values of the rank-two tensor stored by index=(i * LIBMESH_DIM + j)
   Real _vals[N2];
 
@@ -0,0 +1,190 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef REDUCTIONBATCH_H
+#define REDUCTIONBATCH_H
+
+// MOOSE includes
+#include "Moose.h" // using namespace libMesh
+#include "MooseError.h"
+
+#include "libmesh/parallel.h"
+#include "libmesh/parallel_object.h"
+
+// C++ includes
+#include <unordered_set>
+#include <vector>
+
+/**
+ * Collects the global reductions of the values that user objects compute in the same pass and
+ * performs them together, with one allreduce per operation instead of one per value.
+ *
+ * Between begin() and end() the values given to sum(), max() and min() are only registered, and
+ * they are reduced by the next flush(). Values of other types than Real, int and unsigned int are
+ * reduced immediately. Outside of a pass every value is reduced immediately.
+ *
+ * All processors have to register the same values in the same order, which is the case when the
+ * registration happens in finalize() of user objects that run on all processors.
+ */
+class ReductionBatch : public libMesh::ParallelObject
+{
+public:
+  ReductionBatch(const Parallel::Communicator & comm);
+
+  /// Starts collecting reductions
+  void begin();
+
+  /// Performs all the collected reductions
+  void flush();
+
+  /// Performs the remaining collected reductions and stops collecting
+  void end();
+
+  ///@{
+  /**
+   * Reduces value over all processors, or registers it for the next flush() during a pass
+   */
+  void sum(Real & value) { defer(&value, REAL, SUM); }
+  void sum(int & value) { defer(&value, INT, SUM); }
+  void sum(unsigned int & value) { defer(&value, UNSIGNED_INT, SUM); }
+  template <typename T>
+  void sum(T & value);
+
+  void max(Real & value) { defer(&value, REAL, MAX); }
+  void max(int & value) { defer(&value, INT, MAX); }
+  void max(unsigned int & value) { defer(&value, UNSIGNED_INT, MAX); }
+  template <typename T>
+  void max(T & value);
+
+  void min(Real & value) { defer(&value, REAL, MIN); }
+  void min(int & value) { defer(&value, INT, MIN); }
+  void min(unsigned int & value) { defer(&value, UNSIGNED_INT, MIN); }
+  template <typename T>
+  void min(T & value);
+  ///@}
+
+  /**
+   * Whether value was already reduced (or registered for a reduction) during the current pass,
+   * in which case reducing it again would be wrong. A value that is still waiting for its
+   * reduction is reduced right away, together with all the other waiting ones, so that it can be
+   * used.
+   */
+  bool alreadyReduced(const void * value);
+
+  /// The number of values that were reduced together instead of on their own
+  unsigned long int numBatchedValues() const { return _num_batched_values; }
+
+  /// The number of collective operations that were used for them
+  unsigned long int numBatchedReductions() const { return _num_batched_reductions; }
+
+protected:
+  enum Operation
+  {
+    SUM,
+    MAX,
+    MIN,
+    NUM_OPERATIONS
+  };
+
+  enum Type
+  {
+    REAL,
+    INT,
+    UNSIGNED_INT
+  };
+
+  /// A value waiting for its reduction
+  struct Entry
+  {
+    void * value;
+    Type type;
+  };
+
+  /// Registers value for the reduction op, or performs it right away outside of a pass
+  void defer(void * value, Type type, Operation op);
+
+  /// Performs the reduction op of value right away
+  template <typename T>
+  void reduce(T & value, Operation op);
+
+  /// Reduces a value of another type right away, unless that already happened during the pass
+  template <typename T>
+  void reduceOnce(T & value, Operation op);
+
+  /// Whether a pass is going on
+  bool _collecting;
+
+  /// The values waiting for each operation
+  std::vector<Entry> _pending[NUM_OPERATIONS];
+
+  /// The addresses of all the values registered or reduced during the current pass
+  std::unordered_set<const void *> _pending_values;
+  std::unordered_set<const void *> _reduced_values;
+
+  /// Buffer for packing the values of one operation
+  std::vector<Real> _buffer;
+
+  unsigned long int _num_batched_values;
+  unsigned long int _num_batched_reductions;
+};
+
+template <typename T>
+void
+ReductionBatch::sum(T & value)
+{
+  reduceOnce(value, SUM);
+}
+
+template <typename T>
+void
+ReductionBatch::max(T & value)
+{
+  reduceOnce(value, MAX);
+}
+
+template <typename T>
+void
+ReductionBatch::min(T & value)
+{
+  reduceOnce(value, MIN);
+}
+
+template <typename T>
+void
+ReductionBatch::reduce(T & value, Operation op)
+{
+  switch (op)
+  {
+    case SUM:
+      _communicator.sum(value);
+      break;
+    case MAX:
+      _communicator.max(value);
+      break;
+    case MIN:
+      _communicator.min(value);
+      break;
+    default:
+      mooseError("Unknown reduction");
+  }
+}
+
+template <typename T>
+void
+ReductionBatch::reduceOnce(T & value, Operation op)
+{
+  if (alreadyReduced(&value))
+    return;
+
+  reduce(value, op);
+  if (_collecting)
+    _reduced_values.insert(&value);
+}
+
+#endif // REDUCTIONBATCH_H
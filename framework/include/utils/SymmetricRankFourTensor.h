@@ -0,0 +1,176 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef SYMMETRICRANKFOURTENSOR_H
+#define SYMMETRICRANKFOURTENSOR_H
+
+// MOOSE includes
+#include "DataIO.h"
+
+#include "libmesh/tensor_value.h"
+#include "libmesh/libmesh.h"
+
+// Forward declarations
+class RankTwoTensor;
+class RankFourTensor;
+class SymmetricRankFourTensor;
+
+template <typename T>
+void mooseSetToZero(T & v);
+
+/**
+ * Helper function template specialization to set an object to zero.
+ * Needed by DerivativeMaterialInterface
+ */
+template <>
+void mooseSetToZero<SymmetricRankFourTensor>(SymmetricRankFourTensor & v);
+
+/**
+ * SymmetricRankFourTensor holds a three-dimensional fourth order tensor C with the minor
+ * symmetries C_ijkl = C_jikl = C_ijlk, such as an elasticity tensor or the Jacobian of a stress
+ * with respect to a strain.
+ *
+ * Such a tensor is stored packed as the 6x6 Voigt matrix C_ab, with a and b running over the index
+ * pairs 00, 11, 22, 12, 02, 01, so it holds 36 rather than the 81 entries of a RankFourTensor.
+ * Isotropic tensors C_ijkl = lambda d_ij d_kl + mu (d_ik d_jl + d_il d_jk) are only described by
+ * lambda and mu. Contractions, invSymm() and rotate() work on the packed form and reduce to closed
+ * form expressions for isotropic tensors.
+ */
+class SymmetricRankFourTensor
+{
+public:
+  /// The kind of symmetry the tensor is known to have
+  enum SymmetryClass
+  {
+    isotropic,
+    minor_symmetric
+  };
+
+  /// Default constructor; fills to zero
+  SymmetricRankFourTensor();
+
+  /**
+   * Packs a RankFourTensor. Tensors without the minor symmetries are replaced by their
+   * minor-symmetric part (C_ijkl + C_jikl + C_ijlk + C_jilk) / 4, just as RankFourTensor::invSymm
+   * does.
+   */
+  SymmetricRankFourTensor(const RankFourTensor & a);
+
+  /**
+   * Packs a RankFourTensor that is known to have the given symmetry, as guaranteed by its
+   * producer. Isotropic tensors are described by lambda = C_0011 and mu = C_0101 only.
+   */
+  SymmetricRankFourTensor(const RankFourTensor & a, SymmetryClass symmetry);
+
+  /// Named constructor for the isotropic tensor with Lame constants lambda and mu
+  static SymmetricRankFourTensor Isotropic(Real lambda, Real mu);
+
+  /// The symmetry used to store this tensor
+  SymmetryClass symmetryClass() const { return _symmetry; }
+
+  /// Gets the value for the index specified.  Takes indices ranging from 0-2 for i, j, k, and l.
+  Real operator()(unsigned int i, unsigned int j, unsigned int k, unsigned int l) const;
+
+  /// Unpacks the tensor into all its 81 entries
+  RankFourTensor toRankFourTensor() const;
+
+  /// Zeros out the tensor.
+  void zero();
+
+  /// C_ijkl*a_kl
+  RankTwoTensor operator*(const RankTwoTensor & a) const;
+
+  /// C_ijkl*a_klmn
+  SymmetricRankFourTensor operator*(const SymmetricRankFourTensor & a) const;
+
+  /// C_ijkl*a
+  SymmetricRankFourTensor operator*(const Real a) const;
+
+  /// C_ijkl + a_ijkl
+  SymmetricRankFourTensor operator+(const SymmetricRankFourTensor & a) const;
+
+  /// C_ijkl - a_ijkl
+  SymmetricRankFourTensor operator-(const SymmetricRankFourTensor & a) const;
+
+  /**
+   * This returns A_ijkl such that C_ijkl*A_klmn = 0.5*(de_im de_jn + de_in de_jm), the same
+   * result as RankFourTensor::invSymm. Throws a MooseException if the tensor is singular.
+   */
+  SymmetricRankFourTensor invSymm() const;
+
+  /**
+   * Rotate the tensor using
+   * C_ijkl = R_im R_jn R_ko R_lp C_mnop
+   */
+  template <class T>
+  void rotate(const T & R);
+
+  /// Sqrt(C_ijkl*C_ijkl)
+  Real L2norm() const;
+
+protected:
+  static constexpr unsigned int N = 3;
+  static constexpr unsigned int NV = 6;
+
+  /// The Voigt index of the index pair ij
+  static unsigned int voigt(unsigned int i, unsigned int j) { return i == j ? i : 6 - i - j; }
+
+  /// Writes the full 6x6 Voigt matrix of this tensor to vals
+  void fillVoigt(Real vals[NV * NV]) const;
+
+  /// Rotates a minor symmetric tensor by the 6x6 matrix M transforming Voigt stresses
+  void rotateVoigt(const Real M[NV][NV]);
+
+  /// The symmetry used to store this tensor
+  SymmetryClass _symmetry;
+
+  /// The Voigt matrix for minor symmetric tensors, or lambda and mu for isotropic ones
+  Real _vals[NV * NV];
+
+  template <class T>
+  friend void dataStore(std::ostream &, T &, void *);
+
+  template <class T>
+  friend void dataLoad(std::istream &, T &, void *);
+};
+
+template <>
+void dataStore(std::ostream &, SymmetricRankFourTensor &, void *);
+
+template <>
+void dataLoad(std::istream &, SymmetricRankFourTensor &, void *);
+
+inline SymmetricRankFourTensor operator*(Real a, const SymmetricRankFourTensor & b)
+{
+  return b * a;
+}
+
+template <class T>
+void
+SymmetricRankFourTensor::rotate(const T & R)
+{
+  // isotropic tensors are invariant under rotations
+  if (_symmetry == isotropic)
+    return;
+
+  // Voigt stresses transform as s'_a = M_ab s_b, and hence C' = M C M^T
+  Real M[NV][NV];
+  for (unsigned int i = 0; i < N; ++i)
+    for (unsigned int j = i; j < N; ++j)
+    {
+      const unsigned int a = voigt(i, j);
+      for (unsigned int k = 0; k < N; ++k)
+        for (unsigned int l = k; l < N; ++l)
+          M[a][voigt(k, l)] = k == l ? R(i, k) * R(j, k) : R(i, k) * R(j, l) + R(i, l) * R(j, k);
+    }
+
+  rotateVoigt(M);
+}
+
+#endif // SYMMETRICRANKFOURTENSOR_H
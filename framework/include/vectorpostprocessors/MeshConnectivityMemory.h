@@ -0,0 +1,62 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef MESHCONNECTIVITYMEMORY_H
+#define MESHCONNECTIVITYMEMORY_H
+
+#include "GeneralVectorPostprocessor.h"
+#include "CompressedRowTable.h"
+
+// Forward Declarations
+class MeshConnectivityMemory;
+
+template <>
+InputParameters validParams<MeshConnectivityMemory>();
+
+/**
+ * Reports the memory used by the connectivity tables of the MooseMesh, summed over all
+ * processors, next to an estimate of what the std::map based containers they replaced needed.
+ *
+ * There is one entry per table, in this order: node to element, node to active semilocal
+ * element, node to boundary, element to boundary and node to block.
+ */
+class MeshConnectivityMemory : public GeneralVectorPostprocessor
+{
+public:
+  MeshConnectivityMemory(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+
+protected:
+  /**
+   * Adds a table to the vectors
+   * @param table The table
+   * @param map_bytes The estimated memory of the std::map based container holding the same data
+   */
+  template <typename T>
+  void addTable(const CompressedRowTable<T> & table, std::size_t map_bytes);
+
+  /// Estimated memory of a node of a std::map or std::set holding values of the given size
+  static std::size_t treeNodeBytes(std::size_t value_bytes);
+
+  /// Number of ids with values in each table
+  VectorPostprocessorValue & _rows;
+
+  /// Number of values in each table
+  VectorPostprocessorValue & _entries;
+
+  /// Memory used by each table (bytes)
+  VectorPostprocessorValue & _bytes;
+
+  /// Estimated memory of the std::map based containers (bytes)
+  VectorPostprocessorValue & _map_bytes;
+};
+
+#endif // MESHCONNECTIVITYMEMORY_H
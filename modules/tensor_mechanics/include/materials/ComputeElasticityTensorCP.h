@@ -14,6 +14,7 @@
 #include "ElementPropertyReadFile.h"
 #include "RankTwoTensor.h"
 #include "RotationTensor.h"
+#include "SymmetricRankFourTensor.h"
 
 class ComputeElasticityTensorCP;
 
@@ -46,6 +47,12 @@ protected:
 
   /// Rotation matrix
   RotationTensor _R;
+
+  /// Whether _Cijkl has the minor symmetries, so it can be rotated in its packed form
+  const bool _Cijkl_is_minor_symmetric;
+
+  /// Packed copy of the unrotated _Cijkl, which is much cheaper to rotate at every qp
+  SymmetricRankFourTensor _symmetric_Cijkl;
 };
 
 #endif // COMPUTEELASTICITYTENSORCP_H
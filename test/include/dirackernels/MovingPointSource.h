@@ -0,0 +1,44 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef MOVINGPOINTSOURCE_H
+#define MOVINGPOINTSOURCE_H
+
+// Moose Includes
+#include "DiracKernel.h"
+
+// Forward Declarations
+class MovingPointSource;
+
+template <>
+InputParameters validParams<MovingPointSource>();
+
+/**
+ * Adds Dirac points with user-specified IDs that move with a constant
+ * velocity to test the relocation of cached Dirac points.  The
+ * elements returned by addPoint() are checked against a search
+ * through all the local elements.
+ */
+class MovingPointSource : public DiracKernel
+{
+public:
+  MovingPointSource(const InputParameters & parameters);
+
+  virtual void addPoints() override;
+  virtual Real computeQpResidual() override;
+
+protected:
+  /// The positions of the points at time zero
+  const std::vector<Point> & _points;
+
+  /// The velocity of all the points
+  const RealVectorValue _velocity;
+};
+
+#endif // MOVINGPOINTSOURCE_H
@@ -0,0 +1,62 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef LINEARINTERPOLATIONBENCHMARK_H
+#define LINEARINTERPOLATIONBENCHMARK_H
+
+#include "GeneralPostprocessor.h"
+#include "LinearInterpolation.h"
+
+// Forward Declarations
+class LinearInterpolationBenchmark;
+
+template <>
+InputParameters validParams<LinearInterpolationBenchmark>();
+
+/**
+ * Samples a LinearInterpolation at sets of nearby points, the way a material evaluates a table at
+ * the quadrature points of one element after the other, and returns the largest difference to
+ * values found with a plain binary search. Meant to be run as a speed test for different table
+ * sizes.
+ */
+class LinearInterpolationBenchmark : public GeneralPostprocessor
+{
+public:
+  LinearInterpolationBenchmark(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual Real getValue() override;
+
+private:
+  /// How the table is sampled
+  const enum class Method {
+    single,
+    batch,
+    value_and_derivative
+  } _method;
+
+  /// The number of times all the points are sampled per execution
+  const unsigned int _repetitions;
+
+  /// The abscissas and ordinates of the table
+  std::vector<Real> _x;
+  std::vector<Real> _y;
+
+  /// The interpolation being timed
+  LinearInterpolation _interpolation;
+
+  /// The points sampled, consecutive groups of which are close to each other
+  std::vector<Real> _points;
+
+  /// The largest difference to the reference values
+  Real _max_error;
+};
+
+#endif // LINEARINTERPOLATIONBENCHMARK_H
@@ -0,0 +1,50 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef RANKTWOEIGENBENCHMARK_H
+#define RANKTWOEIGENBENCHMARK_H
+
+#include "GeneralPostprocessor.h"
+#include "RankTwoTensor.h"
+
+// Forward Declarations
+class RankTwoEigenBenchmark;
+
+template <>
+InputParameters validParams<RankTwoEigenBenchmark>();
+
+/**
+ * Computes the eigenvalues and eigenvectors of a set of random symmetric tensors, either with the
+ * Jacobi solver used by RankTwoTensor or with LAPACK, and returns the largest residual
+ * |A v - lambda v| found. Meant to be run as a speed test comparing the two solvers.
+ */
+class RankTwoEigenBenchmark : public GeneralPostprocessor
+{
+public:
+  RankTwoEigenBenchmark(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual Real getValue() override;
+
+private:
+  /// Whether to use LAPACK (RankTwoTensor::syev) rather than the Jacobi solver
+  const bool _use_lapack;
+
+  /// The number of times every tensor is decomposed
+  const unsigned int _repetitions;
+
+  /// The random symmetric tensors
+  std::vector<RankTwoTensor> _tensors;
+
+  /// The largest eigenpair residual
+  Real _max_residual;
+};
+
+#endif // RANKTWOEIGENBENCHMARK_H
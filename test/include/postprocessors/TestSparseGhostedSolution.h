@@ -0,0 +1,67 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef TESTSPARSEGHOSTEDSOLUTION_H
+#define TESTSPARSEGHOSTEDSOLUTION_H
+
+#include "GeneralPostprocessor.h"
+
+class TestSparseGhostedSolution;
+class SparseGhostedVector;
+
+template <>
+InputParameters validParams<TestSparseGhostedSolution>();
+
+/**
+ * A postprocessor for testing sparsely ghosted solution vectors against serialized ones
+ */
+class TestSparseGhostedSolution : public GeneralPostprocessor
+{
+public:
+  TestSparseGhostedSolution(const InputParameters & parameters);
+
+  /**
+   * Request the elements again, the ones that were refined or coarsened are gone
+   */
+  virtual void meshChanged() override;
+
+  /**
+   * Reset data
+   */
+  virtual void initialize() override;
+
+  /**
+   * Verify the entries of all available elements against the serialized solution and sum up the
+   * entries owned by this processor
+   */
+  virtual void execute() override;
+
+  /**
+   * Return the summed value.
+   */
+  virtual Real getValue() override;
+
+protected:
+  /// Request all active elements available on this processor
+  void requestElements();
+
+  /// The system to be tested
+  SystemBase & _test_sys;
+
+  /// Reference to the sparsely ghosted solution for the test system
+  SparseGhostedVector & _ghosted_solution;
+
+  /// Reference to the serialized solution for the test system
+  NumericVector<Number> & _serialized_solution;
+
+  /// Sum of the entries of the solution vector
+  Real _sum;
+};
+
+#endif
@@ -0,0 +1,66 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 20
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./time_derivative]
+    type = TimeDerivative
+    variable = u
+  [../]
+
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[DiracKernels]
+  [./point_source]
+    type = MovingPointSource
+    variable = u
+    # Each point crosses into the next element every one or two time
+    # steps, so it is relocated without a search of the whole mesh
+    points = '0.0123 0.2871 0  0.5123 0.6871 0'
+    velocity = '0.4 0 0'
+    allow_moving_points = true
+  [../]
+[]
+
+[BCs]
+  [./all]
+    type = DirichletBC
+    variable = u
+    boundary = 'left right top bottom'
+    value = 0
+  [../]
+[]
+
+[Postprocessors]
+  [./cache_hits]
+    type = DiracPointCacheStatistics
+    statistic = hits
+  [../]
+  [./cache_relocations]
+    type = DiracPointCacheStatistics
+    statistic = relocations
+  [../]
+  [./point_locator_searches]
+    type = DiracPointCacheStatistics
+    statistic = searches
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'PJFNK'
+  num_steps = 10
+  dt = 0.1
+[]
@@ -0,0 +1,124 @@
+# The left block moves up by 0.05 in every time step. The displacement is a nonlinear variable, so
+# the last nearest node search of each time step (the one at the converged solution) sees the
+# nodes moved, and only the slave nodes that are far enough from a tie between two master nodes
+# can skip it.
+[Mesh]
+  type = FileMesh
+  file = long_range.e
+  dim = 2
+  patch_update_strategy = always
+  incremental_nearest_node_search = true
+  displacements = 'disp_x disp_y'
+[]
+
+[Variables]
+  [./u]
+    block = right
+  [../]
+  [./disp_y]
+  [../]
+[]
+
+[AuxVariables]
+  [./linear_field]
+  [../]
+  [./receiver]
+  [../]
+  [./disp_x]
+  [../]
+  [./elemental_reciever]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Functions]
+  [./up]
+    type = ParsedFunction
+    value = 0.05*t
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = CoefDiffusion
+    variable = u
+    coef = 1
+  [../]
+  [./time]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./disp_y]
+    type = Reaction
+    variable = disp_y
+  [../]
+  [./move_left]
+    type = BodyForce
+    variable = disp_y
+    function = up
+    block = left
+  [../]
+[]
+
+[AuxKernels]
+  [./linear_in_y]
+    type = FunctionAux
+    variable = linear_field
+    function = y
+    execute_on = initial
+  [../]
+  [./right_to_left]
+    type = GapValueAux
+    variable = receiver
+    paired_variable = linear_field
+    paired_boundary = rightleft
+    execute_on = timestep_end
+    boundary = leftright
+  [../]
+  [./elemental_right_to_left]
+    type = GapValueAux
+    variable = elemental_reciever
+    paired_variable = linear_field
+    paired_boundary = rightleft
+    boundary = leftright
+  [../]
+[]
+
+[BCs]
+  [./top]
+    type = DirichletBC
+    variable = u
+    boundary = righttop
+    value = 1
+  [../]
+  [./bottom]
+    type = DirichletBC
+    variable = u
+    boundary = rightbottom
+    value = 0
+  [../]
+[]
+
+[Postprocessors]
+  [./skipped]
+    type = NumSkippedNearestNodeSearches
+  [../]
+[]
+
+[Problem]
+  type = FEProblem
+  kernel_coverage_check = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 5
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,91 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./v]
+  [../]
+[]
+
+[AuxKernels]
+  [./v]
+    type = FunctionAux
+    variable = v
+    function = 'x + 2 * y + t'
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = CoefDiffusion
+    variable = u
+    coef = 0.1
+  [../]
+  [./time]
+    type = TimeDerivative
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./aux_ghosted]
+    type = TestSparseGhostedSolution
+    system = aux
+    execute_on = 'initial timestep_end'
+  [../]
+  [./nl_ghosted]
+    type = TestSparseGhostedSolution
+    system = nl
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  # Preconditioned JFNK (default)
+  type = Transient
+  num_steps = 3
+  dt = 0.1
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Adaptivity]
+  marker = box_refine
+  [./Markers]
+    [./box_refine]
+      type = BoxMarker
+      bottom_left = '0.2 0.2 0'
+      top_right = '0.8 0.8 0'
+      inside = REFINE
+      outside = DONT_MARK
+    [../]
+  [../]
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,31 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Postprocessors]
+  [./max_error]
+    type = LinearInterpolationBenchmark
+    method = single
+    table_size = 1000
+    repetitions = 1
+  [../]
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+[]